@@ -0,0 +1,432 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Converts a TrueType (or any FreeType supported) font into a GFXfont header,
+// or a font file when the output name ends in .fnt, with 1, 2 or 4 bits of
+// coverage per pixel.
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#define DPI           141 // Matches the fonts shipped in fonts/*.h
+#define MAX_RANGES    64
+
+struct glyph {
+  uint32_t cp;
+  uint32_t offset;
+  int      w, h, xa, xo, yo;
+  int      blank_first, blank_rows; // Tallest band of blank rows
+};
+
+// Inclusive range of code points.
+struct range {
+  uint32_t first;
+  uint32_t last;
+};
+
+// Bitmaps of all glyphs, packed like GFXfont bitmaps.
+struct bitmap_writer {
+  uint8_t *buf;
+  uint32_t len;  // Bytes written
+  uint32_t size;
+  uint8_t  byte;
+  uint8_t  bits; // Bits used in byte
+};
+
+static int write_byte(struct bitmap_writer *bw, uint8_t byte) {
+  if (bw->len == bw->size) {
+    uint8_t *buf = realloc(bw->buf, bw->size * 2 + 1024);
+    if (!buf) {
+      return -1;
+    }
+    bw->buf   = buf;
+    bw->size  = bw->size * 2 + 1024;
+  }
+  bw->buf[bw->len++] = byte;
+  return 0;
+}
+
+// Writes out a partial byte; glyphs start on a byte boundary.
+static int write_flush(struct bitmap_writer *bw) {
+  if (bw->bits) {
+    uint8_t byte = bw->byte;
+    bw->byte = 0;
+    bw->bits = 0;
+    return write_byte(bw, byte);
+  }
+  return 0;
+}
+
+static int write_pixel(struct bitmap_writer *bw, uint8_t value, int bpp) {
+  bw->byte |= value << (8 - bpp - bw->bits);
+  bw->bits += bpp;
+  if (bw->bits == 8) {
+    return write_flush(bw);
+  }
+  return 0;
+}
+
+// Computes the font metrics that mgos_ili9341_set_font() would otherwise
+// compute at runtime, see ili9341_analyzeFont().
+static void font_metrics(const struct glyph *glyphs, int n, int *height, int *width, int *min_xo, int *min_yo) {
+  int max_hyo = 0, max_w = 0, max_xa = 0;
+
+  *min_xo = 0;
+  *min_yo = 0;
+  for (int i = 0; i < n; i++) {
+    const struct glyph *g = &glyphs[i];
+    if (g->h + g->yo > max_hyo) {
+      max_hyo = g->h + g->yo;
+    }
+    if (g->yo < *min_yo) {
+      *min_yo = g->yo;
+    }
+    if (g->xo < *min_xo) {
+      *min_xo = g->xo;
+    }
+    if (g->w > max_w) {
+      max_w = g->w;
+    }
+    if ((int8_t)g->xa > max_xa) {
+      max_xa = (int8_t)g->xa;
+    }
+  }
+  *height = max_hyo - *min_yo;
+  *width  = max_xa > max_w ? max_xa : max_w;
+}
+
+// Writes the font as a C header, like the fonts in fonts/*.h. Sparse fonts
+// also get a table of their code points.
+static int write_header(FILE *out, const char *name, const char *font_filename, int size, int bpp, bool sparse,
+                        int y_advance, const struct glyph *glyphs, int n, const struct bitmap_writer *bw) {
+  int height, width, min_xo, min_yo;
+
+  if (glyphs[n - 1].offset > UINT16_MAX) {
+    fprintf(stderr, "Bitmaps exceed 64KB, use fewer characters, a smaller size or fewer bits, or write a .fnt file\n");
+    return -1;
+  }
+  fprintf(out, "// Generated by contrib/fontconvert from %s, %dpt, %d bpp\n\n", font_filename, size, bpp);
+  fprintf(out, "#ifndef __FONT_%s_H\n#define __FONT_%s_H\n", name, name);
+  fprintf(out, "const uint8_t %sBitmaps[] = {", name);
+  for (uint32_t i = 0; i < bw->len; i++) {
+    fprintf(out, "%s0x%02X,", (i % 12) ? " " : "\n  ", bw->buf[i]);
+  }
+  fprintf(out, "\n};\n\n");
+
+  fprintf(out, "const GFXglyph %sGlyphs[] = {\n", name);
+  for (int i = 0; i < n; i++) {
+    const struct glyph *g = &glyphs[i];
+    fprintf(out, "  { %5u, %3d, %3d, %3d, %4d, %4d }%s // 0x%02X", g->offset, g->w, g->h, g->xa, g->xo, g->yo, i < n - 1 ? "," : " ", g->cp);
+    if (g->cp < 0x80 && isprint(g->cp) && g->cp != '\\') {
+      fprintf(out, " '%c'", g->cp);
+    }
+    fprintf(out, "\n");
+  }
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "// First row and number of rows of the tallest band of blank rows inside\n// each glyph, which printing skips.\n");
+  fprintf(out, "const uint8_t %sBlankRows[] = {", name);
+  for (int i = 0; i < n; i++) {
+    fprintf(out, "%s%d, %d,", (i % 8) ? " " : "\n  ", glyphs[i].blank_first, glyphs[i].blank_rows);
+  }
+  fprintf(out, "\n};\n\n");
+
+  if (sparse) {
+    fprintf(out, "const uint32_t %sCodepoints[] = {", name);
+    for (int i = 0; i < n; i++) {
+      fprintf(out, "%s0x%04X,", (i % 8) ? " " : "\n  ", glyphs[i].cp);
+    }
+    fprintf(out, "\n};\n\n");
+  }
+
+  font_metrics(glyphs, n, &height, &width, &min_xo, &min_yo);
+  fprintf(out, "const GFXfont %s = {\n  (uint8_t *)%sBitmaps,\n  (GFXglyph *)%sGlyphs,\n", name, name, name);
+  if (sparse) {
+    fprintf(out, "  0, 0, %d, %d, %d, %d, %d, %d, (uint32_t *)%sCodepoints, %d,\n", y_advance, height, width, min_xo, min_yo, bpp, name, n);
+  } else {
+    fprintf(out, "  0x%02X, 0x%02X, %d, %d, %d, %d, %d, %d, NULL, 0,\n", glyphs[0].cp, glyphs[n - 1].cp, y_advance, height, width, min_xo, min_yo, bpp);
+  }
+  fprintf(out, "  (uint8_t *)%sBlankRows\n};\n\n", name);
+  fprintf(out, "// Approx. %u bytes\n#endif // __FONT_%s_H\n", bw->len + n * (sparse ? 13 : 9) + 7, name);
+  return ferror(out) ? -1 : 0;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t value) {
+  *p++ = value >> 24;
+  *p++ = value >> 16;
+  *p++ = value >> 8;
+  *p++ = value;
+  return p;
+}
+
+// Writes the font as a font file for mgos_ili9341_font_load(): a 16 byte
+// header, a record per glyph and the bitmaps. Multi-byte values are in
+// network byte order. Version 1 files hold dense fonts of up to 64KB of
+// bitmaps, version 2 files any font, with code points and 32 bit offsets.
+static int write_binary(FILE *out, int bpp, bool sparse, int y_advance, const struct glyph *glyphs, int n, const struct bitmap_writer *bw) {
+  uint8_t hdr[16] = { 'F', 'N', 'T', 1, glyphs[0].cp, glyphs[n - 1].cp, y_advance, bpp,
+                      bw->len >> 24, bw->len >> 16, bw->len >> 8, bw->len };
+
+  if (sparse || glyphs[n - 1].offset > UINT16_MAX) {
+    hdr[3]  = 2;
+    hdr[4]  = 0;
+    hdr[5]  = 0;
+    hdr[12] = n >> 8;
+    hdr[13] = n;
+  }
+  fwrite(hdr, 1, sizeof(hdr), out);
+  for (int i = 0; i < n; i++) {
+    const struct glyph *g = &glyphs[i];
+    uint8_t             rec[13], *p = rec;
+
+    if (hdr[3] == 2) {
+      p = put_u32(p, g->cp);
+      p = put_u32(p, g->offset);
+    } else {
+      *p++ = g->offset >> 8;
+      *p++ = g->offset;
+    }
+    *p++ = g->w;
+    *p++ = g->h;
+    *p++ = g->xa;
+    *p++ = (uint8_t)g->xo;
+    *p++ = (uint8_t)g->yo;
+    fwrite(rec, 1, p - rec, out);
+  }
+  fwrite(bw->buf, 1, bw->len, out);
+  return ferror(out) ? -1 : 0;
+}
+
+// Renders the glyphs of the code points in ranges. Fonts of a single range
+// up to 0xFF are dense, with a glyph for every code point. Other fonts are
+// sparse, code points that are missing in the font are left out.
+int fontconvert(const char *font_filename, const char *out_filename, const char *name, int size, int bpp,
+                const struct range *ranges, int nranges) {
+  FT_Library           library = NULL;
+  FT_Face              face    = NULL;
+  FILE *               out     = NULL;
+  struct glyph *       glyphs  = NULL;
+  struct bitmap_writer bw;
+  int                  ret = -1, n = 0, count = 0;
+  int                  max    = (1 << bpp) - 1;
+  bool                 sparse = nranges > 1 || ranges[0].last > 0xFF;
+  size_t               len    = strlen(out_filename);
+
+  memset(&bw, 0, sizeof(bw));
+  if (FT_Init_FreeType(&library)) {
+    fprintf(stderr, "Could not initialize FreeType\n");
+    goto exit;
+  }
+  if (FT_New_Face(library, font_filename, 0, &face)) {
+    fprintf(stderr, "Can't read %s\n", font_filename);
+    goto exit;
+  }
+  if (FT_Set_Char_Size(face, size << 6, 0, DPI, 0)) {
+    fprintf(stderr, "Can't set size %d\n", size);
+    goto exit;
+  }
+  for (int r = 0; r < nranges; r++) {
+    count += ranges[r].last - ranges[r].first + 1;
+  }
+  glyphs = calloc(count, sizeof(*glyphs));
+  if (!glyphs) {
+    goto exit;
+  }
+
+  for (int r = 0; r < nranges; r++) {
+    for (uint32_t c = ranges[r].first; c <= ranges[r].last; c++) {
+      struct glyph *g = &glyphs[n];
+      FT_Bitmap *   bitmap;
+
+      if (sparse && !FT_Get_Char_Index(face, c)) {
+        continue;
+      }
+      if (n > 0 && c <= glyphs[n - 1].cp) {
+        fprintf(stderr, "Ranges must be in ascending order and not overlap\n");
+        goto exit;
+      }
+      // The driver keeps 0xFFFF free to mark empty glyph cache slots
+      if (n == UINT16_MAX - 1) {
+        fprintf(stderr, "Fonts can have at most %d glyphs\n", UINT16_MAX - 1);
+        goto exit;
+      }
+      g->cp     = c;
+      g->offset = bw.len;
+      n++;
+      if (FT_Load_Char(face, c, FT_LOAD_RENDER | (bpp == 1 ? FT_LOAD_TARGET_MONO : FT_LOAD_TARGET_NORMAL))) {
+        fprintf(stderr, "Can't render character 0x%02X\n", c);
+        continue;
+      }
+      bitmap = &face->glyph->bitmap;
+      g->w   = bitmap->width;
+      g->h   = bitmap->rows;
+      g->xa  = face->glyph->advance.x >> 6;
+      g->xo  = face->glyph->bitmap_left;
+      g->yo  = 1 - face->glyph->bitmap_top;
+      for (int y = 0, blank = 0; y < g->h; y++) {
+        const uint8_t *row = bitmap->buffer + y * bitmap->pitch;
+        bool           ink = false;
+        for (int x = 0; x < g->w; x++) {
+          uint8_t value;
+          if (bitmap->pixel_mode == FT_PIXEL_MODE_MONO) {
+            value = (row[x / 8] >> (7 - x % 8)) & 1 ? max : 0;
+          } else {
+            value = (row[x] * max + 127) / 255;
+          }
+          if (write_pixel(&bw, value, bpp)) {
+            goto exit;
+          }
+          ink |= value != 0;
+        }
+        // Bands start below the first row, which counts the glyph as printed
+        blank = (ink || y == 0) ? 0 : blank + 1;
+        if (blank > g->blank_rows) {
+          g->blank_first = y - blank + 1;
+          g->blank_rows  = blank;
+        }
+      }
+      if (write_flush(&bw)) {
+        goto exit;
+      }
+    }
+  }
+  if (n == 0) {
+    fprintf(stderr, "None of the characters are in %s\n", font_filename);
+    goto exit;
+  }
+
+  out = fopen(out_filename, "wb");
+  if (!out) {
+    fprintf(stderr, "Could not open %s for writing\n", out_filename);
+    goto exit;
+  }
+  if (len > 4 && !strcmp(out_filename + len - 4, ".fnt")) {
+    ret = write_binary(out, bpp, sparse, face->size->metrics.height >> 6, glyphs, n, &bw);
+  } else {
+    ret = write_header(out, name, font_filename, size, bpp, sparse, face->size->metrics.height >> 6, glyphs, n, &bw);
+  }
+  if (ret) {
+    fprintf(stderr, "Could not write %s\n", out_filename);
+    fclose(out);
+    out = NULL;
+    remove(out_filename);
+    goto exit;
+  }
+  printf("%s: %d glyphs, %u bytes of bitmaps\n", out_filename, n, bw.len);
+
+exit:
+  if (out) {
+    fclose(out);
+  }
+  free(bw.buf);
+  free(glyphs);
+  if (face) {
+    FT_Done_Face(face);
+  }
+  if (library) {
+    FT_Done_FreeType(library);
+  }
+  return ret;
+}
+
+// Parses a comma separated list of code points and ranges of them, such as
+// 0x20-0x7E,0x410-0x44F,0x2103.
+static int parse_ranges(char *s, struct range *ranges, int max) {
+  int n = 0;
+
+  for (char *tok = strtok(s, ","); tok; tok = strtok(NULL, ",")) {
+    char *end;
+    if (n == max) {
+      return -1;
+    }
+    ranges[n].first = strtoul(tok, &end, 0);
+    ranges[n].last  = *end == '-' ? strtoul(end + 1, &end, 0) : ranges[n].first;
+    if (*end || ranges[n].first > ranges[n].last || ranges[n].last > 0x10FFFF) {
+      return -1;
+    }
+    n++;
+  }
+  return n;
+}
+
+int main(int argc, char **argv, char **env) {
+  char *i_value = NULL;
+  char *o_value = NULL;
+  char *n_value = NULL;
+  char *r_value = NULL;
+  int   size = 12, bpp = 4, first = 0x20, last = 0x7E;
+  int   c, nranges;
+  struct range ranges[MAX_RANGES];
+
+  opterr = 0;
+
+  while ((c = getopt(argc, argv, "i:o:n:s:b:f:l:r:")) != -1) {
+    switch (c) {
+    case 'i':
+      i_value = optarg;
+      break;
+
+    case 'o':
+      o_value = optarg;
+      break;
+
+    case 'n':
+      n_value = optarg;
+      break;
+
+    case 's':
+      size = atoi(optarg);
+      break;
+
+    case 'b':
+      bpp = atoi(optarg);
+      break;
+
+    case 'f':
+      first = strtol(optarg, NULL, 0);
+      break;
+
+    case 'l':
+      last = strtol(optarg, NULL, 0);
+      break;
+
+    case 'r':
+      r_value = optarg;
+      break;
+
+    default:
+      abort();
+    }
+  }
+  ranges[0].first = first;
+  ranges[0].last  = last;
+  nranges         = r_value ? parse_ranges(r_value, ranges, MAX_RANGES) : 1;
+  if (!i_value || !o_value || !n_value || size <= 0 || (bpp != 1 && bpp != 2 && bpp != 4) ||
+      first < 0 || last > 0x10FFFF || first > last || nranges <= 0) {
+    printf("Usage: -i <input.ttf> -o <output.h|output.fnt> -n <name> [-s <points>] [-b <1|2|4>] [-f <first>] [-l <last>] [-r <ranges>]\r\n");
+    return -1;
+  }
+
+  return fontconvert(i_value, o_value, n_value, size, bpp, ranges, nranges);
+}
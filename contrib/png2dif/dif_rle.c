@@ -0,0 +1,51 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dif_rle.h"
+
+uint32_t dif_rle(const uint16_t *data, uint16_t width, uint16_t height, uint8_t *out) {
+  uint8_t *p = out;
+  int      xx, yy, n, lit;
+
+  for (yy = 0; yy < height; yy++) {
+    const uint16_t *row = data + yy * width;
+    for (xx = 0, lit = 0; xx <= width; xx += n) {
+      for (n = 1; xx + n < width && n < 129 && row[xx + n] == row[xx]; n++) {
+      }
+      if (xx < width && n == 1 && lit < 128) {
+        lit++;
+        continue;
+      }
+      if (lit > 0) {
+        *p++ = lit - 1;
+        memcpy(p, row + xx - lit, lit * sizeof(uint16_t));
+        p  += lit * sizeof(uint16_t);
+        lit = 0;
+      }
+      if (xx == width) {
+        break;
+      }
+      if (n == 1) {
+        n = 0; // A literal run was full, this pixel starts the next one
+        continue;
+      }
+      *p++ = n + 126;
+      memcpy(p, row + xx, sizeof(uint16_t));
+      p += sizeof(uint16_t);
+    }
+  }
+  return p - out;
+}
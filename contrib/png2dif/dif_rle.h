@@ -0,0 +1,29 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __DIF_RLE_H
+#define __DIF_RLE_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Compresses the pixels into runs that never cross rows: a control byte c
+// below 128 is followed by c + 1 literal pixels, one of 128 or more by a
+// pixel repeated c - 126 times. Returns the number of bytes written to out,
+// which must hold width * height * 2 + height * (width / 128 + 1) bytes.
+uint32_t dif_rle(const uint16_t *data, uint16_t width, uint16_t height, uint8_t *out);
+
+#endif // __DIF_RLE_H
@@ -17,6 +17,7 @@
 #include "mgos.h"
 #include "mgos_ili9341.h"
 #include "upng.h"
+#include "dif_rle.h"
 
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -24,10 +25,12 @@
 #include <arpa/inet.h>
 #include <unistd.h>
 
-int png2dif(char *png_filename, char *dif_filename) {
+int png2dif(char *png_filename, char *dif_filename, bool compress) {
   upng_t *       upng;
-  uint16_t *     data;
+  uint16_t *     data = NULL;
   uint16_t *     dif_buf_p;
+  uint8_t *      rle = NULL;
+  uint32_t       size;
   const uint8_t *png_buf;
   const uint8_t *png_buf_p;
   uint16_t       width, height;
@@ -87,29 +90,44 @@ int png2dif(char *png_filename, char *dif_filename) {
     }
   }
 
+  size = width * height * sizeof(uint16_t);
+  if (compress) {
+    // Worst case: literal runs only, one control byte per 128 pixels.
+    if (!(rle = malloc(size + height * (width / 128 + 1)))) {
+      LOG(LL_ERROR, ("Could not create RLE buffer"));
+      goto exit;
+    }
+    size = dif_rle(data, width, height, rle);
+  }
+
   fd = open(dif_filename, O_CREAT | O_RDWR | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
   if (!fd) {
     LOG(LL_ERROR, ("Could not open %s for writing", dif_filename));
     goto exit;
   }
   write(fd, "DIF", 3);
-  out_byte = 1;
+  out_byte = compress ? 2 : 1;
   write(fd, (void *)&out_byte, 1);
   out = htonl(width);
   write(fd, (void *)&out, 4);
   out = htonl(height);
   write(fd, (void *)&out, 4);
   out = 0;
+  out_byte = compress ? 1 : 0; // Pixel format: RLE or raw
+  memcpy(&out, &out_byte, 1);
   write(fd, (void *)&out, 4);
-  write(fd, (void *)data, width * height * 2);
+  write(fd, compress ? (void *)rle : (void *)data, size);
   close(fd);
-  LOG(LL_INFO, ("%s: w=%d h=%d datasize=%lu", dif_filename, width, height, width * height * sizeof(uint16_t)));
+  LOG(LL_INFO, ("%s: w=%d h=%d datasize=%lu", dif_filename, width, height, (unsigned long)size));
 
   ret = 0;
 exit:
   if (data) {
     free(data);
   }
+  if (rle) {
+    free(rle);
+  }
   if (upng) {
     upng_free(upng);
   }
@@ -120,11 +138,12 @@ exit:
 int main(int argc, char **argv, char **env) {
   char *i_value = NULL;
   char *o_value = NULL;
+  bool  c_value = false;
   int   c;
 
   opterr = 0;
 
-  while ((c = getopt(argc, argv, "i:o:")) != -1) {
+  while ((c = getopt(argc, argv, "i:o:c")) != -1) {
     switch (c) {
     case 'i':
       i_value = optarg;
@@ -134,14 +153,19 @@ int main(int argc, char **argv, char **env) {
       o_value = optarg;
       break;
 
+    case 'c':
+      c_value = true;
+      break;
+
     default:
       abort();
     }
   }
   if (!i_value || !o_value) {
-    printf("Usage: -i <input.png> -o <output.dif>\r\n");
+    printf("Usage: -i <input.png> -o <output.dif> [-c]\r\n");
+    printf("  -c  write a run-length compressed (version 2) DIF\r\n");
     return -1;
   }
 
-  return png2dif(i_value, o_value);
+  return png2dif(i_value, o_value, c_value);
 }
@@ -61,6 +61,22 @@ enum mgos_ili9341_rotation_t {
   ILI9341_LANDSCAPE_FLIP = 3,
 };
 
+struct mgos_ili9341_point {
+  uint16_t x;
+  uint16_t y;
+};
+
+// Driver counters, see mgos_ili9341_get_stats().
+struct mgos_ili9341_stats {
+  uint32_t spi_txns;      // SPI transactions issued
+  uint32_t spi_bytes;     // Bytes written to the SPI bus
+  uint32_t window_setups; // Address windows opened for RAMWR
+  uint32_t window_skips;  // CASET/PASET commands skipped as already programmed
+  uint32_t heap_allocs;   // Heap allocations made by the driver
+  uint32_t glyph_hits;    // Glyphs printed from the glyph cache
+  uint32_t glyph_misses;  // Glyphs expanded into the glyph cache
+};
+
 // Externally callable functions:
 void mgos_ili9341_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 void mgos_ili9341_set_fgcolor(uint8_t r, uint8_t g, uint8_t b);
@@ -68,6 +84,8 @@ void mgos_ili9341_set_bgcolor(uint8_t r, uint8_t g, uint8_t b);
 uint16_t mgos_ili9341_color565(uint8_t r, uint8_t g, uint8_t b);
 void mgos_ili9341_set_fgcolor565(uint16_t rgb);
 void mgos_ili9341_set_bgcolor565(uint16_t rgb);
+// When set, print only draws the glyphs, not their background.
+void mgos_ili9341_set_text_transparent(bool transparent);
 void mgos_ili9341_set_orientation(uint8_t madctl, uint16_t width, uint16_t height);
 void mgos_ili9341_set_dimensions(uint16_t width, uint16_t height);
 void mgos_ili9341_set_rotation(enum mgos_ili9341_rotation_t rotation);
@@ -79,7 +97,14 @@ void mgos_ili9341_fillScreen();
 
 // Geometric shapes:
 void mgos_ili9341_drawPixel(uint16_t x0, uint16_t y0);
+// Draws n points at once, which is much faster than drawing them one by one:
+// adjacent points are merged into runs, each sent as a single window. The
+// colored variant takes one RGB565 color per point.
+void mgos_ili9341_drawPixels(const struct mgos_ili9341_point *pts, size_t n);
+void mgos_ili9341_drawPixelsColor(const struct mgos_ili9341_point *pts, const uint16_t *colors, size_t n);
 void mgos_ili9341_drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+// Draws the segments between consecutive points, including all vertices.
+void mgos_ili9341_drawPolyline(const struct mgos_ili9341_point *pts, size_t n);
 
 void mgos_ili9341_drawRect(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h);
 void mgos_ili9341_fillRect(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h);
@@ -89,12 +114,23 @@ void mgos_ili9341_fillRoundRect(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h
 
 void mgos_ili9341_drawCircle(uint16_t x0, uint16_t y0, uint16_t r);
 void mgos_ili9341_fillCircle(uint16_t x0, uint16_t y0, uint16_t r);
+// Fills the ring between r_inner and r_outer (r_outer <= 160) from angle
+// start to end, in degrees clockwise from 3 o'clock. Use r_inner 0 for a pie.
+// Pixels on the end ray are left to the next arc, so that arcs which meet
+// neither overlap nor leave gaps, as with gauges.
+void mgos_ili9341_fillArc(uint16_t x0, uint16_t y0, uint16_t r_outer, uint16_t r_inner, int16_t start, int16_t end);
 
 void mgos_ili9341_drawTriangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
 void mgos_ili9341_fillTriangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
 
 // Fonts and Printing:
-bool mgos_ili9341_set_font(GFXfont *f);
+bool mgos_ili9341_set_font(const GFXfont *f);
+// Loads a font file made by contrib/fontconvert and selects it. It is freed
+// when another font is selected.
+bool mgos_ili9341_set_font_file(const char *fn);
+// Loads a font file, for use with mgos_ili9341_set_font() and text fields.
+GFXfont *mgos_ili9341_font_load(const char *fn);
+void mgos_ili9341_font_free(GFXfont *font);
 void mgos_ili9341_print(uint16_t x0, uint16_t y0, const char *s);
 void mgos_ili9341_printf(uint16_t x0, uint16_t y0, const char *fmt, ...);
 uint16_t mgos_ili9341_getStringWidth(const char *string);
@@ -106,8 +142,126 @@ int mgos_ili9341_get_max_font_height(void);
 // If n is negative, returns N-th line from the bottom.
 uint16_t mgos_ili9341_line(int n);
 
+// Text fields: a string at a fixed position of the window, in a given font,
+// occupying width pixels. Updates only repaint the glyphs that changed.
+struct mgos_ili9341_textfield;
+struct mgos_ili9341_textfield *mgos_ili9341_textfield_create(uint16_t x0, uint16_t y0, uint16_t width, const GFXfont *font);
+void mgos_ili9341_textfield_set(struct mgos_ili9341_textfield *tf, const char *s);
+void mgos_ili9341_textfield_printf(struct mgos_ili9341_textfield *tf, const char *fmt, ...);
+// Forces a full repaint on the next update, e.g. after clearing the screen.
+void mgos_ili9341_textfield_invalidate(struct mgos_ili9341_textfield *tf);
+void mgos_ili9341_textfield_destroy(struct mgos_ili9341_textfield *tf);
+
+// Consoles: a terminal of width by height pixels at a fixed position of the
+// window, which wraps text in a given font and keeps the last backlog rows.
+// Writing understands \n, \r, \b, \t and the ANSI escapes for cursor
+// movement (ESC[nA..D, ESC[r;cH), erasing (ESC[nJ, ESC[nK) and colors
+// (ESC[...m); columns are counted in characters. Writing only updates the
+// backlog: the display is redrawn every ili9341.console_refresh_ms, or by
+// mgos_ili9341_console_update(). Only a console that spans the width of a
+// portrait screen scrolls in hardware, sending just the new rows; in
+// landscape, and in a narrower console, every row is redrawn when it
+// scrolls. Only one console or chart can own the hardware scroll area, see
+// mgos_ili9341_set_scroll_area().
+struct mgos_ili9341_console;
+struct mgos_ili9341_console *mgos_ili9341_console_create(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height, const GFXfont *font, uint16_t backlog);
+void mgos_ili9341_console_write(struct mgos_ili9341_console *c, const char *data, size_t len);
+void mgos_ili9341_console_print(struct mgos_ili9341_console *c, const char *s);
+void mgos_ili9341_console_printf(struct mgos_ili9341_console *c, const char *fmt, ...);
+void mgos_ili9341_console_update(struct mgos_ili9341_console *c);
+// Shows the backlog from rows above the newest screen rows, 0 to follow them.
+void mgos_ili9341_console_scrollback(struct mgos_ili9341_console *c, uint32_t rows);
+// Forces a full repaint on the next update, e.g. after clearing the screen.
+void mgos_ili9341_console_invalidate(struct mgos_ili9341_console *c);
+void mgos_ili9341_console_destroy(struct mgos_ili9341_console *c);
+
+// Strip charts: the last width samples of a value between min and max, in
+// width by height pixels at a fixed position of the window, drawn in the
+// current foreground and background colors. Adding a sample only sends the
+// column it appears in. Charts that span the height of a landscape screen
+// scroll in hardware, if no other console or chart owns the scroll area;
+// others sweep from left to right.
+struct mgos_ili9341_chart;
+struct mgos_ili9341_chart *mgos_ili9341_chart_create(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height, int32_t min, int32_t max);
+// Grid lines every rows pixels from the bottom and every samples samples,
+// 0 for none, in an RGB565 color.
+void mgos_ili9341_chart_set_grid(struct mgos_ili9341_chart *c, uint16_t rows, uint16_t samples, uint16_t color);
+void mgos_ili9341_chart_add(struct mgos_ili9341_chart *c, int32_t value);
+// Forces a full repaint on the next sample, e.g. after clearing the screen.
+void mgos_ili9341_chart_invalidate(struct mgos_ili9341_chart *c);
+void mgos_ili9341_chart_destroy(struct mgos_ili9341_chart *c);
+
+// Gauges: a ring between r_inner and r_outer around (x0,y0) of the window,
+// from angle start to end (degrees clockwise from 3 o'clock, at most 360
+// apart), showing a value between min and max in the current foreground
+// color on the current background color. With needle 0 the ring fills up
+// from start to the value, otherwise a needle needle degrees wide points at
+// it. Updates only repaint the sectors that changed. The track is erased
+// by filling it in the background color, so the ring has to be on a solid
+// background: an image or pattern under it is painted over.
+struct mgos_ili9341_gauge;
+struct mgos_ili9341_gauge *mgos_ili9341_gauge_create(uint16_t x0, uint16_t y0, uint16_t r_outer, uint16_t r_inner,
+                                                     int16_t start, int16_t end, int32_t min, int32_t max, uint16_t needle);
+void mgos_ili9341_gauge_set(struct mgos_ili9341_gauge *g, int32_t value);
+// Forces a full repaint on the next update, e.g. after clearing the screen.
+void mgos_ili9341_gauge_invalidate(struct mgos_ili9341_gauge *g);
+void mgos_ili9341_gauge_destroy(struct mgos_ili9341_gauge *g);
+
 // Images
 void mgos_ili9341_drawDIF(uint16_t x0, uint16_t y0, char *fn);
+void mgos_ili9341_drawPNG(uint16_t x0, uint16_t y0, char *fn);
+
+// Sends the pixel data staged in the transmit buffer to the display. It
+// does not flush the framebuffer, see mgos_ili9341_flush().
+void mgos_ili9341_fence(void);
+
+// Framebuffer mode: drawing goes into a copy of the screen in RAM, and
+// mgos_ili9341_flush() sends the regions that changed to the display.
+// Returns false if the framebuffer could not be allocated.
+bool mgos_ili9341_set_framebuffer(bool enable);
+void mgos_ili9341_flush(void);
+
+// Band rendering: calls draw() once for every horizontal band of
+// ili9341.band_height rows, with all drawing collected in a strip buffer
+// that is then sent as one window. draw() has to paint the same frame
+// every time; the window and colors are reset before each call, and the
+// strip starts out in the background color.
+typedef void (*mgos_ili9341_draw_cb_t)(void *arg);
+bool mgos_ili9341_render_bands(mgos_ili9341_draw_cb_t draw, void *arg);
+
+// Hardware scrolling: the panel scrolls along its 320 pixel side, which is
+// screen y in portrait orientations and screen x in landscape ones. Lines
+// start to end along that axis form the scroll area, the lines outside of
+// it stay fixed. mgos_ili9341_scroll() moves the content of the area by
+// lines towards its start (up or left); the lines that scroll out come back
+// in at the end, ready to be drawn over. Drawing always uses the screen
+// coordinates where things show up. Changing the rotation ends scrolling.
+// There is one scroll area per display: consoles and charts that scroll in
+// hardware claim it, and while one does, others redraw instead. An area set
+// here is never taken over by them, until the rotation changes.
+bool mgos_ili9341_get_scroll_vertical(void);
+bool mgos_ili9341_set_scroll_area(uint16_t start, uint16_t end);
+void mgos_ili9341_scroll(int16_t lines);
+
+// Recording: everything sent to the display between record_start() and
+// record_stop() is kept, commands and data exactly as they went out, while
+// it is drawn as usual. record_stop() returns the recording, which the
+// caller frees, or NULL if it ran out of memory; record_stop_file() saves it
+// to a file instead. Replaying a recording sends the same bytes again, each
+// command and its data in one transaction, without drawing anything. A
+// recording can be replayed from a const array as well. It addresses display
+// memory, so it shows up as recorded only with the same rotation and scroll
+// offset, and it does not update the framebuffer. Changing the rotation or
+// scrolling while recording makes the recording fail.
+bool mgos_ili9341_record_start(void);
+uint8_t *mgos_ili9341_record_stop(size_t *len);
+bool mgos_ili9341_record_stop_file(const char *fn);
+bool mgos_ili9341_replay(const uint8_t *rec, size_t len);
+bool mgos_ili9341_replay_file(const char *fn);
+
+// Statistics
+void mgos_ili9341_get_stats(struct mgos_ili9341_stats *stats);
+void mgos_ili9341_reset_stats(void);
 
 #ifdef __cplusplus
 }
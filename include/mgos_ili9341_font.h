@@ -21,7 +21,41 @@
 #include "mgos_ili9341.h"
 #include "gfxfont.h"
 
+// Position of a glyph in a laid out string.
+struct ili9341_layout_glyph {
+  uint16_t glyph;    // Index of the glyph in the font
+  int16_t  pen;      // Pen position, where the glyph's cell starts
+  uint8_t  xa;       // Advance of the pen past the glyph
+  int16_t  x;        // Left edge of the glyph box in the string
+  uint8_t  w;
+  uint8_t  h;
+  uint16_t fl;       // First line of the glyph box in the string
+  uint16_t gap0;     // Lines [gap0, gap1) of the box are blank
+  uint16_t gap1;
+  bool     overlaps; // Box overlaps the boxes of preceding glyphs
+};
+
+// String resolved into glyph positions, reused while the font and string
+// stay the same. Lines of multi-line strings are stacked font_height apart.
+struct ili9341_layout {
+  const GFXfont *              font;
+  char *                       text;
+  size_t                       text_size;
+  struct ili9341_layout_glyph *glyphs;
+  size_t                       nglyphs;
+  size_t                       glyphs_size;
+  uint16_t                     width;
+  uint16_t                     height;
+};
+
 // Internal functions -- do not use
-uint16_t ili9341_print_fillPixelLine(const char *string, uint8_t line, uint16_t *buf, uint16_t color);
+bool ili9341_analyzeFont(GFXfont *f);
+int32_t ili9341_font_glyph(const GFXfont *font, uint32_t cp);
+void ili9341_font_forget(const GFXfont *font);
+const uint8_t *ili9341_font_file_bitmap(const GFXfont *font, uint16_t glyph);
+bool ili9341_layout_string(struct ili9341_layout *layout, const GFXfont *font, const char *string);
+void ili9341_layout_free(struct ili9341_layout *layout);
+const struct ili9341_layout *ili9341_print_layout(const char *string);
+void ili9341_print_fillPixelLine(const struct ili9341_layout *layout, uint16_t line, uint16_t *buf, uint16_t fg, uint16_t bg, const uint16_t *colors);
 
 #endif // __MGOS_ILI9341_FONT_H
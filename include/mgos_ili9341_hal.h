@@ -49,7 +49,9 @@
 #define ILI9341_RAMRD          0x2E
 
 #define ILI9341_PTLAR          0x30
+#define ILI9341_VSCRDEF        0x33
 #define ILI9341_MADCTL         0x36
+#define ILI9341_VSCRSADD       0x37
 #define ILI9341_PIXFMT         0x3A
 
 #define ILI9341_FRMCTR1        0xB1
@@ -96,4 +98,37 @@
 
 #define ILI9341_DELAY          0x80
 
+// Stack buffer of the printf functions, longer output is truncated.
+#define ILI9341_PRINTF_BUF_SIZE    128
+
+// Internal functions -- do not use
+
+// Ring between r_inner and r_outer around (x0, y0) of the window, with the
+// row extents of its circles from ili9341_circle_extents().
+struct ili9341_ring {
+  int16_t        x0;
+  int16_t        y0;
+  uint16_t       r_outer;
+  uint16_t       r_inner;
+  const int16_t *ext_o; // Half width of each row of the outer circle
+  const int16_t *ext_i; // and of the inner circle, NULL if r_inner is 0
+  int32_t        center; // Angle whose sector gets the center pixel if r_inner is 0
+};
+
+struct mgos_ili9341_stats;
+struct ili9341_layout;
+void *ili9341_malloc(size_t size);
+struct mgos_ili9341_stats *ili9341_stats(void);
+void ili9341_print_span(uint16_t x0, uint16_t y0, const struct ili9341_layout *layout, uint16_t from, uint16_t to, uint16_t height, const uint16_t *colors);
+void ili9341_get_window_origin(uint16_t *x0, uint16_t *y0);
+void ili9341_get_colors(uint16_t *fg, uint16_t *bg);
+bool ili9341_scroll_claim(const void *owner, uint16_t start, uint16_t end);
+bool ili9341_scroll_owned(const void *owner);
+void ili9341_scroll_release(const void *owner);
+bool ili9341_vformat(char *buf, size_t size, const char *fmt, va_list ap);
+void ili9341_fill_clipped(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void ili9341_write_clipped(int16_t x0, int16_t y0, int16_t x1, int16_t y1, const uint16_t *pixels);
+void ili9341_circle_extents(uint16_t r, int16_t *ext);
+void ili9341_ring_sector(const struct ili9341_ring *ring, int32_t a, int32_t b);
+
 #endif // __MGOS_ILI9341_HAL_H
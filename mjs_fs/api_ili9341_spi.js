@@ -35,6 +35,7 @@ let ILI9341 = {
     color565: ffi('int mgos_ili9341_color565(int, int, int)'),
     setFgColor565: ffi('void mgos_ili9341_set_fgcolor565(int )'),
     setBgColor565: ffi('void mgos_ili9341_set_bgcolor565(int)'),
+    setTextTransparent: ffi('void mgos_ili9341_set_text_transparent(bool)'),
     setDimensions: ffi('void mgos_ili9341_set_dimensions(int, int)'),
     setOrientation: ffi('void mgos_ili9341_set_orientation(int, int, int)'),
     // argument is enum mgos_ili9341_rotation_t
@@ -57,6 +58,7 @@ let ILI9341 = {
 
     drawCircle: ffi('void mgos_ili9341_drawCircle(int, int, int)'),
     fillCircle: ffi('void mgos_ili9341_fillCircle(int, int, int)'),
+    fillArc: ffi('void mgos_ili9341_fillArc(int, int, int, int, int, int)'),
 
     drawTriangle: ffi('void mgos_ili9341_drawTriangle(int, int, int, int, int, int)'),
     fillTriangle: ffi('void mgos_ili9341_fillTriangle(int, int, int, int, int, int)'),
@@ -64,6 +66,9 @@ let ILI9341 = {
     // Fonts and Printing:
     // argument is GFXfont*, need to find a way to get it
     setFont: ffi('bool mgos_ili9341_set_font(void*)'),
+    setFontFile: ffi('bool mgos_ili9341_set_font_file(char*)'),
+    fontLoad: ffi('void *mgos_ili9341_font_load(char*)'),
+    fontFree: ffi('void mgos_ili9341_font_free(void*)'),
     print: ffi('void mgos_ili9341_print(int, int, char*)'),
     getStringWidth: ffi('int mgos_ili9341_getStringWidth(char*)'),
     getStringHeight: ffi('int mgos_ili9341_getStringHeight(char*)'),
@@ -71,6 +76,52 @@ let ILI9341 = {
     getMaxFontHeight: ffi('int mgos_ili9341_get_max_font_height()'),
     line: ffi('int mgos_ili9341_line(int)'),
 
+    // Text fields, repainting only the glyphs that changed
+    textfieldCreate: ffi('void *mgos_ili9341_textfield_create(int, int, int, void*)'),
+    textfieldSet: ffi('void mgos_ili9341_textfield_set(void*, char*)'),
+    textfieldInvalidate: ffi('void mgos_ili9341_textfield_invalidate(void*)'),
+    textfieldDestroy: ffi('void mgos_ili9341_textfield_destroy(void*)'),
+
+    // Consoles, with a backlog and ANSI escapes
+    consoleCreate: ffi('void *mgos_ili9341_console_create(int, int, int, int, void*, int)'),
+    consolePrint: ffi('void mgos_ili9341_console_print(void*, char*)'),
+    consoleUpdate: ffi('void mgos_ili9341_console_update(void*)'),
+    consoleScrollback: ffi('void mgos_ili9341_console_scrollback(void*, int)'),
+    consoleInvalidate: ffi('void mgos_ili9341_console_invalidate(void*)'),
+    consoleDestroy: ffi('void mgos_ili9341_console_destroy(void*)'),
+
+    // Strip charts, sending one column per sample
+    chartCreate: ffi('void *mgos_ili9341_chart_create(int, int, int, int, int, int)'),
+    chartSetGrid: ffi('void mgos_ili9341_chart_set_grid(void*, int, int, int)'),
+    chartAdd: ffi('void mgos_ili9341_chart_add(void*, int)'),
+    chartInvalidate: ffi('void mgos_ili9341_chart_invalidate(void*)'),
+    chartDestroy: ffi('void mgos_ili9341_chart_destroy(void*)'),
+
+    // Gauges, repainting only the sectors that changed
+    gaugeCreate: ffi('void *mgos_ili9341_gauge_create(int, int, int, int, int, int, int, int, int)'),
+    gaugeSet: ffi('void mgos_ili9341_gauge_set(void*, int)'),
+    gaugeInvalidate: ffi('void mgos_ili9341_gauge_invalidate(void*)'),
+    gaugeDestroy: ffi('void mgos_ili9341_gauge_destroy(void*)'),
+
     // Images
     drawDIF: ffi('void mgos_ili9341_drawDIF(int, int, char*)'),
+    drawPNG: ffi('void mgos_ili9341_drawPNG(int, int, char*)'),
+
+    // Waits until all queued pixel data has been written to the display.
+    fence: ffi('void mgos_ili9341_fence()'),
+
+    // Framebuffer mode
+    setFramebuffer: ffi('bool mgos_ili9341_set_framebuffer(bool)'),
+    flush: ffi('void mgos_ili9341_flush()'),
+    renderBands: ffi('bool mgos_ili9341_render_bands(void (*)(userdata), userdata)'),
+
+    // Hardware scrolling
+    getScrollVertical: ffi('bool mgos_ili9341_get_scroll_vertical()'),
+    setScrollArea: ffi('bool mgos_ili9341_set_scroll_area(int, int)'),
+    scroll: ffi('void mgos_ili9341_scroll(int)'),
+
+    // Recording and replaying static screen content
+    recordStart: ffi('bool mgos_ili9341_record_start()'),
+    recordStopFile: ffi('bool mgos_ili9341_record_stop_file(char*)'),
+    replayFile: ffi('bool mgos_ili9341_replay_file(char*)'),
 };
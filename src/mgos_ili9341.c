@@ -16,6 +16,7 @@
 
 #include "mgos_ili9341.h"
 
+#include <stdio.h>
 #include <unistd.h>
 
 #include "common/str_util.h"
@@ -25,6 +26,11 @@
 
 #include "mgos_ili9341_hal.h"
 #include "mgos_ili9341_font.h"
+#include "upng.h"
+
+#if CS_PLATFORM == CS_P_ESP32
+#include "esp_heap_caps.h"
+#endif
 
 #define SPI_MODE    0
 
@@ -35,11 +41,169 @@ struct ili9341_window {
   uint16_t y1;
   uint16_t fg_color; // in network byte order
   uint16_t bg_color; // in network byte order
+  bool     transparent_text; // print leaves background pixels alone
+};
+
+// Bus parameters, read from the config once in mgos_ili9341_spi_init().
+struct ili9341_bus {
+  struct mgos_spi *spi;
+  int              cs;
+  int              freq;
+  int              dc_pin;
+  int              dc; // Current level of the DC pin, -1 if unknown
+};
+
+// Staging buffers of the transmit pipeline.
+struct ili9341_tx {
+  uint8_t *buf[2];
+  uint32_t size; // Size of each buffer in bytes, 0 if not allocated
+  uint32_t len;  // Bytes staged in buf[cur]
+  int      cur;  // Buffer currently being filled
+};
+
+// Pixels of a single color, sent by solid fills.
+struct ili9341_fill {
+  uint16_t *buf;
+  uint32_t  len;   // In pixels
+  uint16_t  color; // Color of all pixels in buf, if valid
+  bool      valid;
+};
+
+// Line buffer of mgos_ili9341_print(), grown as needed.
+struct ili9341_print {
+  uint16_t *buf;
+  uint16_t  size; // In pixels
+};
+
+// Horizontal or vertical run waiting to be drawn, in window coordinates.
+// Runs continuing it on the same row or column are merged into it.
+struct ili9341_run {
+  int16_t x0;
+  int16_t y0;
+  int16_t x1;
+  int16_t y1;
+  bool    pending;
+};
+
+// Scratch space of mgos_ili9341_drawPixels(), grown as needed.
+struct ili9341_plot_point {
+  uint32_t key; // Major coordinate in the upper, minor in the lower half
+  uint32_t idx; // Index of the point in the caller's array
+};
+
+struct ili9341_plot {
+  struct ili9341_plot_point *pts;
+  size_t                     size;
+};
+
+// The address window last programmed into the chip (CASET/PASET).
+struct ili9341_clip_cache {
+  uint16_t x0;
+  uint16_t x1;
+  uint16_t y0;
+  uint16_t y1;
+  bool     x_valid;
+  bool     y_valid;
+};
+
+struct ili9341_rect {
+  uint16_t x0;
+  uint16_t y0;
+  uint16_t x1;
+  uint16_t y1;
+};
+
+// RAM copy of the screen, in network byte order, with its dirty regions.
+// While rendering bands, it holds the rows starting at y0 instead.
+#define ILI9341_FB_DIRTY_MAX    8
+struct ili9341_fb {
+  uint16_t *          buf;
+  uint16_t            width;
+  uint16_t            height;
+  uint16_t            y0;
+  bool                band;
+  struct ili9341_rect dirty[ILI9341_FB_DIRTY_MAX + 1];
+  int                 ndirty;
+};
+
+// Strip buffer used by mgos_ili9341_render_bands().
+struct ili9341_band {
+  uint16_t *buf;
+  uint16_t  width;
+  uint16_t  height;
+};
+
+// Hardware scroll area, in screen coordinates along the scroll axis. Screen
+// line start + i shows the line drawn at start + (i + offset) % (end - start
+// + 1).
+struct ili9341_scroll {
+  uint16_t    start;
+  uint16_t    end;
+  uint16_t    offset;
+  bool        active;
+  const void *owner; // Widget that set the area, &s_scroll for the application
+};
+
+// Address window that crosses the wrap of the scroll area, and is written
+// in pieces: one for each segment of lines that is contiguous in display
+// memory, or one for each segment of each row if the scroll axis is x.
+#define ILI9341_SPLIT_SEGS_MAX    4
+struct ili9341_split {
+  uint16_t x0;
+  uint16_t y0;
+  uint16_t x1;
+  uint16_t y1;
+  uint16_t dst[ILI9341_SPLIT_SEGS_MAX]; // First memory line of each segment
+  uint16_t len[ILI9341_SPLIT_SEGS_MAX]; // Lines in each segment
+  int      nsegs;
+  int      seg;    // Segment being written
+  uint16_t row;    // Row being written, if the scroll axis is x
+  uint32_t left;   // Bytes left in the piece being written
+  bool     active;
+};
+
+// Window and position of the pixel stream being written.
+struct ili9341_stream {
+  uint16_t x0;
+  uint16_t y0;
+  uint16_t x1;
+  uint16_t y1;
+  uint16_t x;
+  uint16_t y;
+};
+
+// Recording of what is sent to the display, see mgos_ili9341_record_start().
+// Each command starts an entry: the command byte, the length of the data
+// that follows it as 4 bytes in network byte order, and the data.
+#define ILI9341_REC_HDR_SIZE    4
+#define ILI9341_REC_ENTRY_HDR   5
+#define ILI9341_REC_BUF_MIN     256
+struct ili9341_rec {
+  uint8_t *buf;
+  uint32_t len;
+  uint32_t size;
+  uint32_t entry;  // Offset of the entry being recorded, 0 if none
+  bool     active;
+  bool     failed; // Out of memory, the recording is incomplete
 };
 
 static uint16_t s_screen_width;
 static uint16_t s_screen_height;
 static struct ili9341_window s_window;
+static struct ili9341_bus s_bus;
+static struct ili9341_clip_cache s_clip;
+static struct ili9341_tx s_tx;
+static struct ili9341_fill s_fill;
+static struct ili9341_plot s_plot;
+static struct ili9341_print s_print;
+static struct ili9341_fb s_fb;
+static struct ili9341_band s_band;
+static struct ili9341_stream s_stream;
+static struct ili9341_scroll s_scroll;
+static struct ili9341_split s_split;
+static struct ili9341_rec s_rec;
+static uint8_t s_madctl;
+static struct mgos_ili9341_stats s_stats;
 
 static const uint8_t ILI9341_init[] = {
   ILI9341_SWRESET,   ILI9341_DELAY, 5,    //  1: Software reset, no args, w/ 5 ms delay afterwards
@@ -74,39 +238,286 @@ static const uint8_t ILI9341_init[] = {
 };
 
 
+// All heap allocations of the driver go through here, so that they show up
+// in the statistics.
+void *ili9341_malloc(size_t size) {
+  s_stats.heap_allocs++;
+  return malloc(size);
+}
+
+// Recording -- appends what goes over the bus to s_rec while recording.
+// Function names start with ili9341_rec_ and are all declared static.
+static bool ili9341_rec_reserve(uint32_t n) {
+  uint32_t size = s_rec.size ? s_rec.size : ILI9341_REC_BUF_MIN;
+  uint8_t *buf;
+
+  if (s_rec.failed) {
+    return false;
+  }
+  if (s_rec.len + n <= s_rec.size) {
+    return true;
+  }
+  while (size < s_rec.len + n) {
+    size *= 2;
+  }
+  if (!(buf = ili9341_malloc(size))) {
+    LOG(LL_ERROR, ("Could not grow recording to %u bytes", (unsigned)size));
+    s_rec.failed = true;
+    return false;
+  }
+  if (s_rec.buf) {
+    memcpy(buf, s_rec.buf, s_rec.len);
+    free(s_rec.buf);
+  }
+  s_rec.buf  = buf;
+  s_rec.size = size;
+  return true;
+}
+
+// Writes the data length of the current entry into its header.
+static void ili9341_rec_close(void) {
+  uint32_t n;
+
+  if (s_rec.entry == 0) {
+    return;
+  }
+  n = s_rec.len - s_rec.entry - ILI9341_REC_ENTRY_HDR;
+  s_rec.buf[s_rec.entry + 1] = n >> 24;
+  s_rec.buf[s_rec.entry + 2] = n >> 16;
+  s_rec.buf[s_rec.entry + 3] = n >> 8;
+  s_rec.buf[s_rec.entry + 4] = n;
+  s_rec.entry = 0;
+}
+
+// Commands whose state the driver keeps (orientation and scrolling) cannot
+// be replayed without leaving that state behind, so they are not recorded.
+static bool ili9341_rec_allowed(uint8_t cmd) {
+  return cmd != ILI9341_MADCTL && cmd != ILI9341_VSCRDEF && cmd != ILI9341_VSCRSADD;
+}
+
+static void ili9341_rec_cmd(uint8_t cmd) {
+  ili9341_rec_close();
+  if (!ili9341_rec_allowed(cmd) && !s_rec.failed) {
+    LOG(LL_ERROR, ("Recording stopped by command 0x%02x, which changes rotation or scrolling", cmd));
+    s_rec.failed = true;
+  }
+  if (!ili9341_rec_reserve(ILI9341_REC_ENTRY_HDR)) {
+    return;
+  }
+  s_rec.entry          = s_rec.len;
+  s_rec.buf[s_rec.len] = cmd;
+  s_rec.len           += ILI9341_REC_ENTRY_HDR;
+}
+
+// Data goes into the current entry, so that all pixels written after one
+// RAMWR end up in one piece of data, however they were sent.
+static void ili9341_rec_data(const uint8_t *data, uint32_t size) {
+  if (s_rec.entry == 0 || !ili9341_rec_reserve(size)) {
+    return;
+  }
+  memcpy(s_rec.buf + s_rec.len, data, size);
+  s_rec.len += size;
+}
+
 // SPI -- Hardware Interface, function names start with ili9341_spi_
 // and are all declared static.
-static void ili9341_spi_write(const uint8_t *data, uint32_t size) {
-  struct mgos_spi *spi = mgos_spi_get_global();
+static void ili9341_spi_init(void) {
+  s_bus.spi    = mgos_spi_get_global();
+  s_bus.cs     = mgos_sys_config_get_ili9341_cs_index();
+  s_bus.freq   = mgos_sys_config_get_ili9341_spi_freq();
+  s_bus.dc_pin = mgos_sys_config_get_ili9341_dc_pin();
+  s_bus.dc     = -1;
+}
 
-  if (!spi) {
+static void ili9341_spi_write(const uint8_t *data, uint32_t size) {
+  if (!s_bus.spi) {
     LOG(LL_ERROR, ("SPI is disabled, set spi.enable=true"));
     return;
   }
 
   struct mgos_spi_txn txn = {
-    .cs   = mgos_sys_config_get_ili9341_cs_index(),
+    .cs   = s_bus.cs,
     .mode = SPI_MODE,
-    .freq = mgos_sys_config_get_ili9341_spi_freq(),
+    .freq = s_bus.freq,
   };
   txn.hd.tx_data   = data,
   txn.hd.tx_len    = size,
   txn.hd.dummy_len = 0,
   txn.hd.rx_len    = 0,
   txn.hd.rx_data   = NULL,
-  mgos_spi_run_txn(spi, false, &txn);
+  mgos_spi_run_txn(s_bus.spi, false, &txn);
+  s_stats.spi_txns++;
+  s_stats.spi_bytes += size;
 }
 
-static void ili9341_spi_write8_cmd(uint8_t byte) {
-  // Command has DC low and CS low while writing to SPI bus.
-  mgos_gpio_write(mgos_sys_config_get_ili9341_dc_pin(), 0);
-  ili9341_spi_write(&byte, 1);
+// Command has DC low, data has DC high. The pin is only toggled when the
+// level actually changes, so streams of data writes do not touch GPIO.
+static void ili9341_spi_dc(int level) {
+  if (s_bus.dc == level) {
+    return;
+  }
+  mgos_gpio_write(s_bus.dc_pin, level);
+  s_bus.dc = level;
+}
+
+static void ili9341_spi_write_data(const uint8_t *data, uint32_t size) {
+  if (s_rec.active) {
+    ili9341_rec_data(data, size);
+  }
+  ili9341_spi_dc(1);
+  ili9341_spi_write(data, size);
+}
+
+// Transmit pipeline -- pixel data is staged in one of two buffers and handed
+// to the bus when the buffer fills up, before the next command, and at the
+// end of every drawing primitive. The buffers alternate, so the one just
+// handed to the bus is never written to next. mgos_spi transactions are
+// synchronous, so a submitted buffer has been sent by the time the call
+// returns. Function names start with ili9341_tx_ and are all declared static.
+#define ILI9341_TX_BUF_MIN    64
+static void ili9341_tx_init(void) {
+  uint32_t size = mgos_sys_config_get_ili9341_tx_buf_size() & ~1;
+
+  if (s_tx.buf[0]) {
+    return;
+  }
+  if (size < ILI9341_TX_BUF_MIN) {
+    size = ILI9341_TX_BUF_MIN;
+  }
+  s_tx.buf[0] = ili9341_malloc(size);
+  s_tx.buf[1] = ili9341_malloc(size);
+  if (!s_tx.buf[0] || !s_tx.buf[1]) {
+    LOG(LL_ERROR, ("Could not allocate 2x%u bytes for transmit buffers", (unsigned)size));
+    free(s_tx.buf[0]);
+    free(s_tx.buf[1]);
+    s_tx.buf[0] = s_tx.buf[1] = NULL;
+    return;
+  }
+  s_tx.size = size;
+  s_tx.len  = 0;
+  s_tx.cur  = 0;
+}
+
+static void ili9341_split_next(void);
+
+// Sends data to the bus, and returns once it has been sent. Data for a
+// split window is cut where one piece ends and the next begins.
+static void ili9341_tx_submit(const uint8_t *data, uint32_t len) {
+  while (len > 0) {
+    uint32_t n = len;
+
+    if (s_split.active) {
+      if (s_split.left == 0) {
+        ili9341_split_next();
+      }
+      n             = n < s_split.left ? n : s_split.left;
+      s_split.left -= n;
+    }
+    ili9341_spi_write_data(data, n);
+    data += n;
+    len  -= n;
+  }
+}
+
+// Sends whatever is staged, and switches to the other buffer. The buffer
+// counts as empty while it is submitted, so that commands sent in between
+// (for split windows) do not flush it again.
+static void ili9341_tx_flush(void) {
+  uint32_t len = s_tx.len;
+
+  if (len == 0) {
+    return;
+  }
+  s_tx.len = 0;
+  ili9341_tx_submit(s_tx.buf[s_tx.cur], len);
+  s_tx.cur ^= 1;
+}
+
+// Returns space in the staging buffer for up to *len bytes of pixel data,
+// and sets *len to the number of bytes that can be written there. Callers
+// render into it and then call ili9341_tx_commit(). Returns NULL if the
+// transmit buffers were not allocated.
+static uint8_t *ili9341_tx_reserve(uint32_t *len) {
+  if (!s_tx.size) {
+    return NULL;
+  }
+  if (s_tx.size - s_tx.len < 2) {
+    ili9341_tx_flush();
+  }
+  if (*len > s_tx.size - s_tx.len) {
+    *len = (s_tx.size - s_tx.len) & ~1;
+  }
+  return s_tx.buf[s_tx.cur] + s_tx.len;
+}
+
+static void ili9341_tx_commit(uint32_t len) {
+  s_tx.len += len;
+  if (s_tx.len >= s_tx.size) {
+    ili9341_tx_flush();
+  }
+}
+
+// Queues pixel data. Small writes are coalesced in the staging buffer;
+// writes that would fill it anyway are sent straight from the caller's
+// buffer. Either way, 'data' may be reused when this returns.
+static void ili9341_tx_write(const uint8_t *data, uint32_t len) {
+  if (len >= s_tx.size) {
+    ili9341_tx_flush();
+    ili9341_tx_submit(data, len);
+    return;
+  }
+  if (len > s_tx.size - s_tx.len) {
+    ili9341_tx_flush();
+  }
+  memcpy(s_tx.buf[s_tx.cur] + s_tx.len, data, len);
+  ili9341_tx_commit(len);
 }
 
-static void ili9341_spi_write8(uint8_t byte) {
-  // Data has DC high and CS low while writing to SPI bus.
-  mgos_gpio_write(mgos_sys_config_get_ili9341_dc_pin(), 1);
-  ili9341_spi_write(&byte, 1);
+// Fill buffer -- a driver owned run of identical pixels, which solid fills
+// send over and over again. It is only rewritten when the color changes.
+static void ili9341_fill_init(void) {
+  uint32_t len = mgos_sys_config_get_ili9341_fill_chunk();
+
+  if (s_fill.buf || len == 0) {
+    return;
+  }
+  if (!(s_fill.buf = ili9341_malloc(len * sizeof(uint16_t)))) {
+    LOG(LL_ERROR, ("Could not allocate %u pixel fill buffer", (unsigned)len));
+    return;
+  }
+  s_fill.len   = len;
+  s_fill.valid = false;
+}
+
+static void ili9341_fill_write(uint16_t color, uint32_t n) {
+  uint32_t len;
+
+  if (!s_fill.valid || s_fill.color != color) {
+    for (uint32_t i = 0; i < s_fill.len; i++) {
+      s_fill.buf[i] = color;
+    }
+    s_fill.color = color;
+    s_fill.valid = true;
+  }
+  ili9341_tx_flush();
+  for (; n > 0; n -= len) {
+    len = n < s_fill.len ? n : s_fill.len;
+    ili9341_tx_submit((uint8_t *)s_fill.buf, len * sizeof(uint16_t));
+  }
+}
+
+// Sends a command byte followed by its arguments, as two transactions.
+// Pixel data still staged for the previous command goes out first.
+static void ili9341_spi_write_cmd(uint8_t cmd, const uint8_t *args, uint32_t nargs) {
+  ili9341_tx_flush();
+  if (s_rec.active) {
+    ili9341_rec_cmd(cmd);
+  }
+  ili9341_spi_dc(0);
+  ili9341_spi_write(&cmd, 1);
+  if (nargs > 0) {
+    ili9341_spi_write_data(args, nargs);
+  }
 }
 
 // ILI9341 Primitives -- these methods call SPI commands directly,
@@ -124,11 +535,7 @@ static void ili9341_commandList(const uint8_t *addr) {
     delay    = numArgs & ILI9341_DELAY;                 // If high bit set, delay follows args
     numArgs &= ~ILI9341_DELAY;                          // Mask out delay bit
 
-    mgos_gpio_write(mgos_sys_config_get_ili9341_dc_pin(), 0);
-    ili9341_spi_write(&cmd, 1);
-
-    mgos_gpio_write(mgos_sys_config_get_ili9341_dc_pin(), 1);
-    ili9341_spi_write((uint8_t *)addr, numArgs);
+    ili9341_spi_write_cmd(cmd, addr, numArgs);
     addr += numArgs;
 
     if (delay) {
@@ -138,85 +545,491 @@ static void ili9341_commandList(const uint8_t *addr) {
   }
 }
 
+// Forget the programmed address window, for example after a reset or a
+// MADCTL change, so that the next ili9341_set_clip() sends both ranges.
+static void ili9341_clip_invalidate(void) {
+  s_clip.x_valid = false;
+  s_clip.y_valid = false;
+}
+
+// Programs the address window and issues RAMWR. Column or page ranges that
+// are still programmed from the previous call are not sent again.
+static void ili9341_clip_program(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+  uint8_t args[4];
+
+  s_stats.window_setups++;
+  if (s_clip.x_valid && s_clip.x0 == x0 && s_clip.x1 == x1) {
+    s_stats.window_skips++;
+  } else {
+    args[0] = x0 >> 8;
+    args[1] = x0 & 0xFF;                 // XSTART
+    args[2] = x1 >> 8;
+    args[3] = x1 & 0xFF;                 // XEND
+    ili9341_spi_write_cmd(ILI9341_CASET, args, 4);
+    s_clip.x0      = x0;
+    s_clip.x1      = x1;
+    s_clip.x_valid = true;
+  }
+  if (s_clip.y_valid && s_clip.y0 == y0 && s_clip.y1 == y1) {
+    s_stats.window_skips++;
+  } else {
+    args[0] = y0 >> 8;
+    args[1] = y0 & 0xFF;                 // YSTART
+    args[2] = y1 >> 8;
+    args[3] = y1 & 0xFF;                 // YEND
+    ili9341_spi_write_cmd(ILI9341_PASET, args, 4);
+    s_clip.y0      = y0;
+    s_clip.y1      = y1;
+    s_clip.y_valid = true;
+  }
+  ili9341_spi_write_cmd(ILI9341_RAMWR, NULL, 0);
+}
+
+// Hardware scrolling -- the panel scrolls along its 320 pixel side, which
+// is screen y in portrait orientations and screen x in landscape ones.
+// Drawing is mapped to the memory lines where it shows. Function names
+// start with ili9341_scroll_ and ili9341_split_ and are all declared
+// static.
+static bool ili9341_scroll_vertical(void) {
+  return !(s_madctl & MADCTL_MV);
+}
+
+static uint16_t ili9341_scroll_lines(void) {
+  return ili9341_scroll_vertical() ? s_screen_height : s_screen_width;
+}
+
+// Memory line, in screen coordinates, that screen line a is drawn to.
+static uint16_t ili9341_scroll_map(uint16_t a) {
+  if (!s_scroll.active || a < s_scroll.start || a > s_scroll.end) {
+    return a;
+  }
+  return s_scroll.start + (a - s_scroll.start + s_scroll.offset) % (s_scroll.end - s_scroll.start + 1);
+}
+
+// Splits screen lines a0 to a1 into segments that are contiguous in memory.
+// Returns the number of segments.
+static int ili9341_scroll_segments(uint16_t a0, uint16_t a1, uint16_t *dst, uint16_t *len) {
+  int n = 0;
+
+  for (uint32_t a = a0, end; a <= a1; a = end + 1) {
+    uint16_t m = ili9341_scroll_map(a);
+
+    end = a1;
+    if (s_scroll.active && a < s_scroll.start && end >= s_scroll.start) {
+      end = s_scroll.start - 1;
+    } else if (s_scroll.active && a >= s_scroll.start && a <= s_scroll.end) {
+      end = end < s_scroll.end ? end : s_scroll.end;
+      end = end < a + s_scroll.end - m ? end : a + s_scroll.end - m;
+    }
+    if (n > 0 && dst[n - 1] + len[n - 1] == m) {
+      len[n - 1] += end - a + 1;
+      continue;
+    }
+    dst[n] = m;
+    len[n] = end - a + 1;
+    n++;
+  }
+  return n;
+}
+
+// Programs the window of the piece being written.
+static void ili9341_split_program(void) {
+  struct ili9341_split *sp  = &s_split;
+  uint16_t              d0  = sp->dst[sp->seg];
+  uint16_t              d1  = d0 + sp->len[sp->seg] - 1;
+
+  if (ili9341_scroll_vertical()) {
+    ili9341_clip_program(sp->x0, d0, sp->x1, d1);
+    sp->left = (uint32_t)(sp->x1 - sp->x0 + 1) * sp->len[sp->seg] * sizeof(uint16_t);
+  } else {
+    ili9341_clip_program(d0, sp->row, d1, sp->active ? sp->row : sp->y1);
+    sp->left = (uint32_t)sp->len[sp->seg] * sizeof(uint16_t);
+  }
+}
+
+// Moves on to the next piece. Like the chip, writing past the end of the
+// window starts over at its beginning.
+static void ili9341_split_next(void) {
+  struct ili9341_split *sp = &s_split;
+
+  if (++sp->seg == sp->nsegs) {
+    sp->seg = 0;
+    if (!ili9341_scroll_vertical() && ++sp->row > sp->y1) {
+      sp->row = sp->y0;
+    }
+  }
+  ili9341_split_program();
+}
+
+// Opens an address window in screen coordinates for RAMWR.
 static void ili9341_set_clip(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
-  ili9341_spi_write8_cmd(ILI9341_CASET); // Column addr set
-  ili9341_spi_write8(x0 >> 8);
-  ili9341_spi_write8(x0 & 0xFF);         // XSTART
-  ili9341_spi_write8(x1 >> 8);
-  ili9341_spi_write8(x1 & 0xFF);         // XEND
-  ili9341_spi_write8_cmd(ILI9341_PASET); // Row addr set
-  ili9341_spi_write8(y0 >> 8);
-  ili9341_spi_write8(y0);                // YSTART
-  ili9341_spi_write8(y1 >> 8);
-  ili9341_spi_write8(y1);                // YEND
-  ili9341_spi_write8_cmd(ILI9341_RAMWR); // write to RAM
-  return;
+  struct ili9341_split *sp = &s_split;
+  bool                  v  = ili9341_scroll_vertical();
+
+  sp->active = false;
+  if (!s_scroll.active) {
+    ili9341_clip_program(x0, y0, x1, y1);
+    return;
+  }
+  sp->x0    = x0;
+  sp->y0    = y0;
+  sp->x1    = x1;
+  sp->y1    = y1;
+  sp->seg   = 0;
+  sp->row   = y0;
+  sp->nsegs  = ili9341_scroll_segments(v ? y0 : x0, v ? y1 : x1, sp->dst, sp->len);
+  sp->active = sp->nsegs > 1;
+  ili9341_split_program();
 }
 
-// buf represents a 16-bit RGB 565 uint16_t color buffer of length buflen bytes (so buflen/2 pixels).
-// Note: data in 'buf' has to be in network byte order!
-static void ili9341_send_pixels(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint8_t *buf, uint32_t buflen) {
-  uint16_t winsize = (x1 - x0 + 1) * (y1 - y0 + 1);
+// VSCRSADD takes the memory line shown at the top of the area, counted in
+// the panel's own line order, which MADCTL MY reverses.
+static void ili9341_scroll_program(bool area) {
+  uint16_t lines = ili9341_scroll_lines();
+  uint16_t n     = s_scroll.end - s_scroll.start + 1;
+  uint16_t tfa   = s_scroll.start;
+  uint16_t vsp   = s_scroll.offset;
+  uint8_t  args[6];
+
+  if (s_madctl & MADCTL_MY) {
+    tfa = lines - 1 - s_scroll.end;
+    vsp = (n - vsp) % n;
+  }
+  vsp += tfa;
+  if (area) {
+    args[0] = tfa >> 8;
+    args[1] = tfa & 0xFF;
+    args[2] = n >> 8;
+    args[3] = n & 0xFF;
+    args[4] = (lines - tfa - n) >> 8;
+    args[5] = (lines - tfa - n) & 0xFF;
+    ili9341_spi_write_cmd(ILI9341_VSCRDEF, args, 6);
+  }
+  args[0] = vsp >> 8;
+  args[1] = vsp & 0xFF;
+  ili9341_spi_write_cmd(ILI9341_VSCRSADD, args, 2);
+}
 
-  if (y0 + s_window.y0 > s_window.y1 || x0 + s_window.x0 > s_window.x1) {
+// Ends scrolling, showing display memory as it is.
+static void ili9341_scroll_reset(void) {
+  if (!s_scroll.active) {
     return;
   }
-  if (y1 + s_window.y0 > s_window.y1) {
-    y1 = s_window.y1 - s_window.y0;
+  s_scroll.start  = 0;
+  s_scroll.end    = ili9341_scroll_lines() - 1;
+  s_scroll.offset = 0;
+  ili9341_scroll_program(true);
+  s_scroll.active = false;
+  s_scroll.owner  = NULL;
+}
+
+// Framebuffer -- when enabled, drawing goes into a RAM copy of the screen
+// and only the dirty rectangles are sent out by mgos_ili9341_flush().
+// Function names start with ili9341_fb_ and are all declared static.
+static uint32_t ili9341_rect_area(const struct ili9341_rect *r) {
+  return (uint32_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static void ili9341_rect_union(struct ili9341_rect *r, const struct ili9341_rect *o) {
+  if (o->x0 < r->x0) r->x0 = o->x0;
+  if (o->y0 < r->y0) r->y0 = o->y0;
+  if (o->x1 > r->x1) r->x1 = o->x1;
+  if (o->y1 > r->y1) r->y1 = o->y1;
+}
+
+// Number of pixels that merging a and b would send needlessly.
+static int32_t ili9341_rect_merge_waste(const struct ili9341_rect *a, const struct ili9341_rect *b) {
+  struct ili9341_rect u = *a, i;
+  int32_t             overlap = 0;
+
+  ili9341_rect_union(&u, b);
+  i.x0 = a->x0 > b->x0 ? a->x0 : b->x0;
+  i.y0 = a->y0 > b->y0 ? a->y0 : b->y0;
+  i.x1 = a->x1 < b->x1 ? a->x1 : b->x1;
+  i.y1 = a->y1 < b->y1 ? a->y1 : b->y1;
+  if (i.x0 <= i.x1 && i.y0 <= i.y1) {
+    overlap = ili9341_rect_area(&i);
   }
-  if (x1 + s_window.x0 > s_window.x1) {
-    x1 = s_window.x1 - s_window.x0;
+  return (int32_t)ili9341_rect_area(&u) - ili9341_rect_area(a) - ili9341_rect_area(b) + overlap;
+}
+
+// Adds a rectangle to the dirty set. Rectangles are merged when that wastes
+// at most ILI9341_FB_MERGE_SLACK pixels, or when the set is full, in which
+// case the pair that wastes the least is merged.
+#define ILI9341_FB_MERGE_SLACK    32
+static void ili9341_fb_mark(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+  struct ili9341_rect *d = s_fb.dirty;
+
+  if (s_fb.band) {
+    return;
+  }
+  if (x1 >= s_fb.width) {
+    x1 = s_fb.width - 1;
   }
+  if (y1 >= s_fb.height) {
+    y1 = s_fb.height - 1;
+  }
+  if (x0 > x1 || y0 > y1) {
+    return;
+  }
+  d[s_fb.ndirty].x0 = x0;
+  d[s_fb.ndirty].y0 = y0;
+  d[s_fb.ndirty].x1 = x1;
+  d[s_fb.ndirty].y1 = y1;
+  s_fb.ndirty++;
+
+  while (s_fb.ndirty > 1) {
+    int     best_i = 0, best_j = 1;
+    int32_t best   = INT32_MAX;
+
+    for (int i = 0; i < s_fb.ndirty; i++) {
+      for (int j = i + 1; j < s_fb.ndirty; j++) {
+        int32_t waste = ili9341_rect_merge_waste(&d[i], &d[j]);
+        if (waste < best) {
+          best   = waste;
+          best_i = i;
+          best_j = j;
+        }
+      }
+    }
+    if (best > ILI9341_FB_MERGE_SLACK && s_fb.ndirty <= ILI9341_FB_DIRTY_MAX) {
+      break;
+    }
+    ili9341_rect_union(&d[best_i], &d[best_j]);
+    d[best_j] = d[--s_fb.ndirty];
+  }
+}
+
+static void ili9341_fb_free(void) {
+  free(s_fb.buf);
+  s_fb.buf    = NULL;
+  s_fb.ndirty = 0;
+}
+
+// (Re)allocates the framebuffer for the current screen dimensions. Its old
+// content is kept but the whole screen is marked dirty.
+static bool ili9341_fb_alloc(void) {
+  uint32_t size = (uint32_t)s_screen_width * s_screen_height * sizeof(uint16_t);
+
+  if (s_fb.buf && s_fb.width * s_fb.height * sizeof(uint16_t) != size) {
+    ili9341_fb_free();
+  }
+  if (!s_fb.buf) {
+#if CS_PLATFORM == CS_P_ESP32
+    s_stats.heap_allocs++;
+    s_fb.buf = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#endif
+    if (!s_fb.buf) {
+      s_fb.buf = ili9341_malloc(size);
+    }
+    if (!s_fb.buf) {
+      LOG(LL_ERROR, ("Could not allocate %u bytes for the framebuffer", (unsigned)size));
+      return false;
+    }
+    memset(s_fb.buf, 0, size);
+  }
+  s_fb.width  = s_screen_width;
+  s_fb.height = s_screen_height;
+  s_fb.ndirty = 0;
+  ili9341_fb_mark(0, 0, s_fb.width - 1, s_fb.height - 1);
+  return true;
+}
+
+// Sends the dirty rectangles to the display, each as a single window. Rows
+// of a full-width rectangle are contiguous and go out in one write.
+static void ili9341_fb_flush(void) {
+  for (int i = 0; i < s_fb.ndirty; i++) {
+    struct ili9341_rect *r = &s_fb.dirty[i];
+    uint32_t             w = r->x1 - r->x0 + 1;
+
+    ili9341_set_clip(r->x0, r->y0, r->x1, r->y1);
+    if (w == s_fb.width) {
+      ili9341_tx_write((uint8_t *)(s_fb.buf + r->y0 * s_fb.width), w * (r->y1 - r->y0 + 1) * sizeof(uint16_t));
+      continue;
+    }
+    for (uint16_t y = r->y0; y <= r->y1; y++) {
+      ili9341_tx_write((uint8_t *)(s_fb.buf + y * s_fb.width + r->x0), w * sizeof(uint16_t));
+    }
+  }
+  ili9341_tx_flush();
+  s_fb.ndirty = 0;
+}
+
+static void ili9341_fb_reverse(uint16_t a, uint16_t b) {
+  uint16_t *buf = s_fb.buf;
+  uint16_t  t;
+
+  for (; a < b; a++, b--) {
+    if (ili9341_scroll_vertical()) {
+      uint16_t *p = buf + (uint32_t)a * s_fb.width, *q = buf + (uint32_t)b * s_fb.width;
+      for (uint16_t x = 0; x < s_fb.width; x++) {
+        t = p[x], p[x] = q[x], q[x] = t;
+      }
+      continue;
+    }
+    for (uint32_t i = 0; i < (uint32_t)s_fb.width * s_fb.height; i += s_fb.width) {
+      t = buf[i + a], buf[i + a] = buf[i + b], buf[i + b] = t;
+    }
+  }
+}
 
-  if (buflen != winsize * 2) {
-    LOG(LL_ERROR, ("Want buflen(%d), to be twice the window size(%d)", (int)buflen, winsize));
+// Moves the lines of the scroll area k lines towards its start, with the
+// ones that scroll out coming back in at the end, as on the display.
+static void ili9341_fb_scroll(uint16_t k) {
+  ili9341_fb_reverse(s_scroll.start, s_scroll.start + k - 1);
+  ili9341_fb_reverse(s_scroll.start + k, s_scroll.end);
+  ili9341_fb_reverse(s_scroll.start, s_scroll.end);
+}
+
+// Pixel streams -- a window in screen coordinates is opened, and pixels are
+// written into it row by row, left to right. Depending on the mode, they go
+// to the display or into the framebuffer. Function names start with
+// ili9341_stream_ and are all declared static.
+static void ili9341_stream_begin(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+  s_stream.x0 = s_stream.x = x0;
+  s_stream.y0 = s_stream.y = y0;
+  s_stream.x1 = x1;
+  s_stream.y1 = y1;
+  if (s_fb.buf) {
+    ili9341_fb_mark(x0, y0, x1, y1);
     return;
   }
+  ili9341_set_clip(x0, y0, x1, y1);
+}
 
-  winsize = (x1 - x0 + 1) * (y1 - y0 + 1);
+static void ili9341_stream_advance(uint32_t n) {
+  uint32_t w   = s_stream.x1 - s_stream.x0 + 1;
+  uint32_t off = s_stream.x - s_stream.x0 + n;
 
-  ili9341_set_clip(x0 + s_window.x0, y0 + s_window.y0, x1 + s_window.x0, y1 + s_window.y0);
-  ili9341_spi_write8_cmd(ILI9341_RAMWR);
-  mgos_gpio_write(mgos_sys_config_get_ili9341_dc_pin(), 1);
-  ili9341_spi_write(buf, winsize * 2);
+  s_stream.y += off / w;
+  s_stream.x  = s_stream.x0 + off % w;
 }
 
-#define ILI9341_FILLRECT_CHUNK    256
-static void ili9341_fillRect(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h) {
+// Returns space for up to *n pixels at the stream position, and sets *n to
+// the number of pixels that can be rendered there. Callers write pixels in
+// network byte order and then call ili9341_stream_commit().
+static uint16_t *ili9341_stream_reserve(uint32_t *n) {
+  uint32_t len;
+
+  if (s_fb.buf) {
+    uint32_t row = s_stream.x1 - s_stream.x + 1;
+    if (*n > row) {
+      *n = row;
+    }
+    if (s_stream.y >= s_fb.y0 && s_stream.y < s_fb.y0 + s_fb.height && s_stream.x < s_fb.width) {
+      if (s_stream.x + *n > s_fb.width) {
+        *n = s_fb.width - s_stream.x;
+      }
+      return s_fb.buf + (s_stream.y - s_fb.y0) * s_fb.width + s_stream.x;
+    }
+    // Off screen: render into scratch space which is never committed.
+  }
+  len = *n * sizeof(uint16_t);
+  uint16_t *buf = (uint16_t *)ili9341_tx_reserve(&len);
+  *n = len / sizeof(uint16_t);
+  return buf;
+}
+
+static void ili9341_stream_commit(uint32_t n) {
+  if (!s_fb.buf) {
+    ili9341_tx_commit(n * sizeof(uint16_t));
+  }
+  ili9341_stream_advance(n);
+}
+
+// Narrows the screen rows [*y0, *y1] to those where pixels can land: all of
+// them, or the rows held by the framebuffer. Returns false if none are left.
+static bool ili9341_stream_rows(uint16_t *y0, uint16_t *y1) {
+  if (s_fb.buf) {
+    if (*y0 < s_fb.y0) {
+      *y0 = s_fb.y0;
+    }
+    if (*y1 > s_fb.y0 + s_fb.height - 1) {
+      *y1 = s_fb.y0 + s_fb.height - 1;
+    }
+  }
+  return *y0 <= *y1;
+}
+
+// Returns how many of the next n pixels of the stream fall in rows above or
+// below the framebuffer, so that callers can skip them without rendering.
+static uint32_t ili9341_stream_offscreen(uint32_t n) {
+  uint32_t w = s_stream.x1 - s_stream.x0 + 1;
+  uint32_t skip;
+
+  if (s_stream.y >= s_fb.y0 + s_fb.height) {
+    return n;
+  }
+  if (s_stream.y >= s_fb.y0) {
+    return 0;
+  }
+  skip = (s_stream.x1 - s_stream.x + 1) + (uint32_t)(s_fb.y0 - s_stream.y - 1) * w;
+  return skip < n ? skip : n;
+}
+
+static void ili9341_stream_write(const uint16_t *pixels, uint32_t n) {
   uint16_t *buf;
-  uint32_t  i;
-  uint32_t  todo_len;
-  uint32_t  buflen;
+  uint32_t  len;
 
-  todo_len = w * h;
-  if (todo_len == 0) {
+  if (!s_fb.buf) {
+    ili9341_tx_write((const uint8_t *)pixels, n * sizeof(uint16_t));
+    ili9341_stream_advance(n);
     return;
   }
+  for (; n > 0; n -= len, pixels += len) {
+    if ((len = ili9341_stream_offscreen(n)) > 0) {
+      ili9341_stream_advance(len);
+      continue;
+    }
+    len = n;
+    if (!(buf = ili9341_stream_reserve(&len))) {
+      return;
+    }
+    memcpy(buf, pixels, len * sizeof(uint16_t));
+    ili9341_stream_commit(len);
+  }
+}
 
-  // Allocate at most 2*FILLRECT_CHUNK bytes
-  buflen = (todo_len < ILI9341_FILLRECT_CHUNK ? todo_len : ILI9341_FILLRECT_CHUNK);
+// Long runs are sent from the fill buffer, short ones are staged, so that
+// runs of different colors share transactions.
+static void ili9341_stream_fill(uint16_t color, uint32_t n) {
+  uint16_t *buf;
+  uint32_t  len;
 
-  if (!(buf = malloc(buflen * sizeof(uint16_t)))) {
+  if (!s_fb.buf && s_fill.buf && n * sizeof(uint16_t) >= s_tx.size) {
+    ili9341_fill_write(color, n);
+    ili9341_stream_advance(n);
     return;
   }
+  for (; n > 0; n -= len) {
+    if (s_fb.buf && (len = ili9341_stream_offscreen(n)) > 0) {
+      ili9341_stream_advance(len);
+      continue;
+    }
+    len = n;
+    if (!(buf = ili9341_stream_reserve(&len))) {
+      return;
+    }
+    for (uint32_t i = 0; i < len; i++) {
+      buf[i] = color;
+    }
+    ili9341_stream_commit(len);
+  }
+}
 
-  for (i = 0; i < buflen; i++) {
-    buf[i] = s_window.fg_color;
+static void ili9341_stream_end(void) {
+  if (!s_fb.buf) {
+    ili9341_tx_flush();
   }
+}
 
-  ili9341_set_clip(x0, y0, x0 + w - 1, y0 + h - 1);
-  ili9341_spi_write8_cmd(ILI9341_RAMWR);
-  mgos_gpio_write(mgos_sys_config_get_ili9341_dc_pin(), 1);
-  while (todo_len) {
-    if (todo_len >= buflen) {
-      ili9341_spi_write((uint8_t *)buf, buflen * 2);
-      todo_len -= buflen;
-    } else {
-      ili9341_spi_write((uint8_t *)buf, todo_len * 2);
-      todo_len = 0;
-    }
+static void ili9341_fillRect(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h) {
+  if (w == 0 || h == 0) {
+    return;
   }
-  free(buf);
+  ili9341_stream_begin(x0, y0, x0 + w - 1, y0 + h - 1);
+  ili9341_stream_fill(s_window.fg_color, (uint32_t)w * h);
+  ili9341_stream_end();
 }
 
 static void ili9341_drawPixel(uint16_t x0, uint16_t y0) {
@@ -227,9 +1040,227 @@ static void ili9341_drawPixel(uint16_t x0, uint16_t y0) {
   if (y0 + s_window.y0 > s_window.y1) {
     return;
   }
-  ili9341_set_clip(x0 + s_window.x0, y0 + s_window.y0, x0 + s_window.x0 + 1, y0 + s_window.y0 + 1);
-  mgos_gpio_write(mgos_sys_config_get_ili9341_dc_pin(), 1);
-  ili9341_spi_write((uint8_t *)&s_window.fg_color, 2);
+  ili9341_stream_begin(x0 + s_window.x0, y0 + s_window.y0, x0 + s_window.x0, y0 + s_window.y0);
+  ili9341_stream_write(&s_window.fg_color, 1);
+  ili9341_stream_end();
+}
+
+// Fills the window relative rectangle [x0,x1]x[y0,y1], clipped to the window.
+// Coordinates may be negative or past the window edge, as produced by shapes
+// that extend over the border.
+void ili9341_fill_clipped(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  int16_t w = s_window.x1 - s_window.x0;
+  int16_t h = s_window.y1 - s_window.y0;
+
+  if (x0 < 0) {
+    x0 = 0;
+  }
+  if (y0 < 0) {
+    y0 = 0;
+  }
+  if (x1 > w) {
+    x1 = w;
+  }
+  if (y1 > h) {
+    y1 = h;
+  }
+  if (x0 > x1 || y0 > y1) {
+    return;
+  }
+  ili9341_fillRect(s_window.x0 + x0, s_window.y0 + y0, x1 - x0 + 1, y1 - y0 + 1);
+}
+
+// Writes pixels, in network byte order and in rows of x1 - x0 + 1, to the
+// window relative rectangle [x0,x1]x[y0,y1], clipped to the window.
+void ili9341_write_clipped(int16_t x0, int16_t y0, int16_t x1, int16_t y1, const uint16_t *pixels) {
+  int16_t  w      = s_window.x1 - s_window.x0;
+  int16_t  h      = s_window.y1 - s_window.y0;
+  uint16_t stride = x1 - x0 + 1;
+
+  if (x0 < 0) {
+    pixels -= x0;
+    x0      = 0;
+  }
+  if (y0 < 0) {
+    pixels -= (int32_t)y0 * stride;
+    y0      = 0;
+  }
+  if (x1 > w) {
+    x1 = w;
+  }
+  if (y1 > h) {
+    y1 = h;
+  }
+  if (x0 > x1 || y0 > y1) {
+    return;
+  }
+  ili9341_stream_begin(s_window.x0 + x0, s_window.y0 + y0, s_window.x0 + x1, s_window.y0 + y1);
+  for (int16_t y = y0; y <= y1; y++, pixels += stride) {
+    ili9341_stream_write(pixels, x1 - x0 + 1);
+  }
+  ili9341_stream_end();
+}
+
+// Run accumulator -- line rasterizers hand in runs one by one, and runs that
+// extend the pending one on the same row or column are merged into it.
+static void ili9341_run_flush(struct ili9341_run *run) {
+  if (run->pending) {
+    ili9341_fill_clipped(run->x0, run->y0, run->x1, run->y1);
+    run->pending = false;
+  }
+}
+
+static void ili9341_run_add(struct ili9341_run *run, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  if (run->pending) {
+    if (y0 == y1 && run->y0 == run->y1 && y0 == run->y0 && x0 <= run->x1 + 1 && x1 + 1 >= run->x0) {
+      run->x0 = x0 < run->x0 ? x0 : run->x0;
+      run->x1 = x1 > run->x1 ? x1 : run->x1;
+      return;
+    }
+    if (x0 == x1 && run->x0 == run->x1 && x0 == run->x0 && y0 <= run->y1 + 1 && y1 + 1 >= run->y0) {
+      run->y0 = y0 < run->y0 ? y0 : run->y0;
+      run->y1 = y1 > run->y1 ? y1 : run->y1;
+      return;
+    }
+    ili9341_run_flush(run);
+  }
+  run->x0      = x0;
+  run->y0      = y0;
+  run->x1      = x1;
+  run->y1      = y1;
+  run->pending = true;
+}
+
+// Bresenham rasterizer, handing the line (x0,y0)-(x1,y1) to the accumulator
+// as one run per step of the minor axis. Both end points are included, unless
+// skip_first is set, in which case (x0,y0) is left out.
+static void ili9341_line_runs(struct ili9341_run *run, int16_t x0, int16_t y0, int16_t x1, int16_t y1, bool skip_first) {
+  bool    steep = abs(y1 - y0) > abs(x1 - x0);
+  bool    reversed;
+  int16_t dx, dy, err, ystep, xs, skip;
+
+  if (steep) {
+    swap(x0, y0);
+    swap(x1, y1);
+  }
+  reversed = x0 > x1;
+  if (reversed) {
+    swap(x0, x1);
+    swap(y0, y1);
+  }
+  // Major axis coordinate of the pixel to leave out, if any
+  skip  = !skip_first ? INT16_MIN : (reversed ? x1 : x0);
+  dx    = x1 - x0;
+  dy    = abs(y1 - y0);
+  err   = dx >> 1;
+  ystep = y0 < y1 ? 1 : -1;
+  xs    = x0;
+
+  for (int16_t x = x0; x <= x1; x++) {
+    err -= dy;
+    if (err < 0 || x == x1) {
+      int16_t a = (xs == skip) ? xs + 1 : xs;
+      int16_t b = (x == skip) ? x - 1 : x;
+      if (a <= b) {
+        if (steep) {
+          ili9341_run_add(run, y0, a, y0, b);
+        } else {
+          ili9341_run_add(run, a, y0, b, y0);
+        }
+      }
+      if (err < 0) {
+        err += dx;
+        y0  += ystep;
+      }
+      xs = x + 1;
+    }
+  }
+}
+
+// Point plotting -- batches of points are sorted and sent as horizontal and
+// vertical runs, one window per run.
+static int ili9341_plot_cmp(const void *a, const void *b) {
+  const struct ili9341_plot_point *pa = a, *pb = b;
+
+  if (pa->key != pb->key) {
+    return pa->key < pb->key ? -1 : 1;
+  }
+  return pa->idx < pb->idx ? -1 : pa->idx > pb->idx;
+}
+
+// Sends the points p[i..i+len) as a run, vertical runs have x in the
+// upper half of their key.
+static void ili9341_plot_run(const struct ili9341_plot_point *p, size_t len, bool vertical, const uint16_t *colors) {
+  uint16_t major = p->key >> 16, minor = p->key & 0xFFFF;
+  uint16_t x     = vertical ? major : minor;
+  uint16_t y     = vertical ? minor : major;
+
+  if (!colors) {
+    ili9341_fillRect(x, y, vertical ? 1 : len, vertical ? len : 1);
+    return;
+  }
+  ili9341_stream_begin(x, y, vertical ? x : x + len - 1, vertical ? y + len - 1 : y);
+  for (size_t i = 0; i < len; i++) {
+    uint16_t color = htons(colors[p[i].idx]);
+    ili9341_stream_write(&color, 1);
+  }
+  ili9341_stream_end();
+}
+
+static void ili9341_drawPixels(const struct mgos_ili9341_point *pts, const uint16_t *colors, size_t n) {
+  struct ili9341_plot_point *p;
+  size_t                     count = 0, singles = 0, i, j;
+
+  if (n > s_plot.size) {
+    free(s_plot.pts);
+    s_plot.size = 0;
+    if (!(s_plot.pts = ili9341_malloc(n * sizeof(*s_plot.pts)))) {
+      LOG(LL_ERROR, ("Could not allocate %u points", (unsigned)n));
+      return;
+    }
+    s_plot.size = n;
+  }
+  p = s_plot.pts;
+
+  // Row major order, keeping the last of duplicate points.
+  for (i = 0; i < n; i++) {
+    if (pts[i].x + s_window.x0 > s_window.x1 || pts[i].y + s_window.y0 > s_window.y1) {
+      continue;
+    }
+    p[count].key = ((uint32_t)(pts[i].y + s_window.y0) << 16) | (pts[i].x + s_window.x0);
+    p[count].idx = i;
+    count++;
+  }
+  qsort(p, count, sizeof(*p), ili9341_plot_cmp);
+  for (i = 0, j = 0; i < count; i++) {
+    if (i + 1 < count && p[i + 1].key == p[i].key) {
+      continue;
+    }
+    p[j++] = p[i];
+  }
+  count = j;
+
+  // Horizontal runs of two or more pixels are sent right away, the other
+  // points are moved to the front in column major order.
+  for (i = 0; i < count; i = j) {
+    for (j = i + 1; j < count && p[j].key == p[j - 1].key + 1 && (p[j].key >> 16) == (p[i].key >> 16); j++) {
+    }
+    if (j - i > 1) {
+      ili9341_plot_run(&p[i], j - i, false, colors);
+      continue;
+    }
+    p[singles].key = (p[i].key << 16) | (p[i].key >> 16);
+    p[singles].idx = p[i].idx;
+    singles++;
+  }
+
+  // What is left goes out as vertical runs.
+  qsort(p, singles, sizeof(*p), ili9341_plot_cmp);
+  for (i = 0; i < singles; i = j) {
+    for (j = i + 1; j < singles && p[j].key == p[j - 1].key + 1 && (p[j].key >> 16) == (p[i].key >> 16); j++) {
+    }
+    ili9341_plot_run(&p[i], j - i, true, colors);
+  }
 }
 
 // External primitives -- these are exported and all functions
@@ -269,9 +1300,16 @@ void mgos_ili9341_set_bgcolor565(uint16_t rgb) {
   s_window.bg_color = htons(rgb);
 }
 
+void mgos_ili9341_set_text_transparent(bool transparent) {
+  s_window.transparent_text = transparent;
+}
+
 void mgos_ili9341_set_dimensions(uint16_t width, uint16_t height) {
   s_screen_width  = width;
   s_screen_height = height;
+  if (s_fb.buf && (s_fb.width != width || s_fb.height != height)) {
+    ili9341_fb_alloc();
+  }
 }
 
 /* Many screen implementations differ in orientation. Here's some application hints:
@@ -287,9 +1325,11 @@ void mgos_ili9341_set_dimensions(uint16_t width, uint16_t height) {
  */
 void mgos_ili9341_set_orientation(uint8_t madctl, uint16_t rows, uint16_t cols) {
   madctl |= ILI9341_MADCTL_BGR;
-  ili9341_spi_write8_cmd(ILI9341_MADCTL);
-  ili9341_spi_write8(madctl);
+  ili9341_spi_write_cmd(ILI9341_MADCTL, &madctl, 1);
+  ili9341_clip_invalidate();
+  s_madctl = madctl;
   mgos_ili9341_set_dimensions(rows,cols);
+  ili9341_scroll_reset();
   mgos_ili9341_set_window(0, 0, mgos_ili9341_get_screenWidth() - 1, mgos_ili9341_get_screenHeight() - 1);
 }
 
@@ -330,17 +1370,101 @@ void mgos_ili9341_set_rotation(enum mgos_ili9341_rotation_t rotation) {
     else
       mgos_ili9341_set_dimensions(h,w);
   }
-  ili9341_spi_write8_cmd(ILI9341_MADCTL);
-  ili9341_spi_write8(madctl);
-  mgos_ili9341_set_window(0, 0, mgos_ili9341_get_screenWidth() - 1, mgos_ili9341_get_screenHeight() - 1);
-  return;
+  ili9341_spi_write_cmd(ILI9341_MADCTL, &madctl, 1);
+  ili9341_clip_invalidate();
+  s_madctl = madctl;
+  ili9341_scroll_reset();
+  mgos_ili9341_set_window(0, 0, mgos_ili9341_get_screenWidth() - 1, mgos_ili9341_get_screenHeight() - 1);
+  return;
+}
+
+bool mgos_ili9341_get_scroll_vertical(void) {
+  return ili9341_scroll_vertical();
+}
+
+// A new area starts out unscrolled, which moves whatever was scrolled back
+// to where it was drawn into the display RAM. The framebuffer still holds the
+// screen as it was, so it is all sent again on the next flush.
+static bool ili9341_scroll_set_area(uint16_t start, uint16_t end) {
+  if (start > end || end >= ili9341_scroll_lines()) {
+    return false;
+  }
+  if (s_fb.buf && !s_fb.band) {
+    ili9341_fb_flush();
+    if (s_scroll.active && s_scroll.offset) {
+      ili9341_fb_mark(0, 0, s_fb.width - 1, s_fb.height - 1);
+    }
+  }
+  s_scroll.start  = start;
+  s_scroll.end    = end;
+  s_scroll.offset = 0;
+  s_scroll.active = true;
+  ili9341_scroll_program(true);
+  return true;
+}
+
+// An area set by the application is never taken over by widgets.
+bool mgos_ili9341_set_scroll_area(uint16_t start, uint16_t end) {
+  if (!ili9341_scroll_set_area(start, end)) {
+    return false;
+  }
+  s_scroll.owner = &s_scroll;
+  return true;
+}
+
+// There is only one scroll area, so widgets that scroll in hardware claim
+// it, and others fall back to redrawing. Claiming fails if the area belongs
+// to the application or to another widget.
+bool ili9341_scroll_claim(const void *owner, uint16_t start, uint16_t end) {
+  if (s_scroll.active && s_scroll.owner && s_scroll.owner != owner) {
+    return false;
+  }
+  if (!ili9341_scroll_set_area(start, end)) {
+    return false;
+  }
+  s_scroll.owner = owner;
+  return true;
+}
+
+// Whether owner still has the area, which changing the rotation ends.
+bool ili9341_scroll_owned(const void *owner) {
+  return s_scroll.active && s_scroll.owner == owner;
+}
+
+void ili9341_scroll_release(const void *owner) {
+  if (s_scroll.owner == owner) {
+    s_scroll.owner = NULL;
+  }
+}
+
+// Only the offset changes on the chip. A framebuffer is flushed first, and
+// then rotated along with the display, so that it keeps matching it.
+void mgos_ili9341_scroll(int16_t lines) {
+  int32_t n = s_scroll.end - s_scroll.start + 1;
+  int32_t k = lines % n;
+
+  if (!s_scroll.active || s_fb.band) {
+    return;
+  }
+  if (k < 0) {
+    k += n;
+  }
+  if (k == 0) {
+    return;
+  }
+  if (s_fb.buf) {
+    ili9341_fb_flush();
+    ili9341_fb_scroll(k);
+  }
+  s_scroll.offset = (s_scroll.offset + k) % n;
+  ili9341_scroll_program(false);
 }
 
 void mgos_ili9341_set_inverted(bool inverted) {
   if (inverted) {
-    ili9341_spi_write8_cmd(ILI9341_INVON);
+    ili9341_spi_write_cmd(ILI9341_INVON, NULL, 0);
   } else{
-    ili9341_spi_write8_cmd(ILI9341_INVOFF);
+    ili9341_spi_write_cmd(ILI9341_INVOFF, NULL, 0);
   }
 }
 
@@ -380,61 +1504,26 @@ void mgos_ili9341_drawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
     return ili9341_fillRect(s_window.x0 + x0, s_window.y0 + y0, x1 - x0, 1);
   }
 
-  int steep = 0;
-  if (abs(y1 - y0) > abs(x1 - x0)) {
-    steep = 1;
-  }
-  if (steep) {
-    swap(x0, y0);
-    swap(x1, y1);
-  }
-  if (x0 > x1) {
-    swap(x0, x1);
-    swap(y0, y1);
-  }
+  struct ili9341_run run = { .pending = false };
+  ili9341_line_runs(&run, x0, y0, x1, y1, false);
+  ili9341_run_flush(&run);
+}
 
-  int16_t dx = x1 - x0, dy = abs(y1 - y0);
-  int16_t err = dx >> 1, ystep = -1, xs = x0, dlen = 0;
+void mgos_ili9341_drawPolyline(const struct mgos_ili9341_point *pts, size_t n) {
+  struct ili9341_run run = { .pending = false };
 
-  if (y0 < y1) {
-    ystep = 1;
+  if (!pts || n == 0) {
+    return;
   }
-  // Split into steep and not steep for FastH/V separation
-  if (steep) {
-    for (; x0 <= x1; x0++) {
-      dlen++;
-      err -= dy;
-      if (err < 0) {
-        err += dx;
-        if (dlen == 1) {
-          ili9341_drawPixel(y0, xs);
-        } else{
-          mgos_ili9341_drawLine(y0, xs, y0, xs + dlen);
-        }
-        dlen = 0; y0 += ystep; xs = x0 + 1;
-      }
-    }
-    if (dlen) {
-      mgos_ili9341_drawLine(y0, xs, y0, xs + dlen);
-    }
-  }else {
-    for (; x0 <= x1; x0++) {
-      dlen++;
-      err -= dy;
-      if (err < 0) {
-        err += dx;
-        if (dlen == 1) {
-          ili9341_drawPixel(xs, y0);
-        } else{
-          mgos_ili9341_drawLine(xs, y0, xs + dlen, y0);
-        }
-        dlen = 0; y0 += ystep; xs = x0 + 1;
-      }
-    }
-    if (dlen) {
-      mgos_ili9341_drawLine(xs, y0, xs + dlen, y0);
-    }
+  if (n == 1) {
+    ili9341_run_add(&run, pts[0].x, pts[0].y, pts[0].x, pts[0].y);
   }
+  for (size_t i = 1; i < n; i++) {
+    // Each vertex after the first was already drawn as the end of the
+    // previous segment.
+    ili9341_line_runs(&run, pts[i - 1].x, pts[i - 1].y, pts[i].x, pts[i].y, i > 1);
+  }
+  ili9341_run_flush(&run);
 }
 
 void mgos_ili9341_fillRect(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h) {
@@ -457,57 +1546,285 @@ void mgos_ili9341_drawPixel(uint16_t x0, uint16_t y0) {
   return ili9341_drawPixel(x0, y0);
 }
 
+void mgos_ili9341_drawPixels(const struct mgos_ili9341_point *pts, size_t n) {
+  return ili9341_drawPixels(pts, NULL, n);
+}
+
+void mgos_ili9341_drawPixelsColor(const struct mgos_ili9341_point *pts, const uint16_t *colors, size_t n) {
+  if (!colors) {
+    return;
+  }
+  return ili9341_drawPixels(pts, colors, n);
+}
+
 void mgos_ili9341_fillScreen() {
   return ili9341_fillRect(0, 0, s_screen_width, s_screen_height);
 }
 
-void mgos_ili9341_print(uint16_t x0, uint16_t y0, const char *string) {
-  uint16_t  pixelline_width = 0;
-  uint16_t *pixelline;
-  uint16_t  lines;
+// Draws columns [from, to) and rows [0, height) of a laid out string placed at
+// (x0,y0) in the window, through a single window. Pixels past the extent of
+// the string are drawn in the background color. If colors is not NULL, it
+// holds a foreground and background color for each glyph, and the glyph's
+// advance cell is filled with its background.
+void ili9341_print_span(uint16_t x0, uint16_t y0, const struct ili9341_layout *layout, uint16_t from, uint16_t to, uint16_t height, const uint16_t *colors) {
+  uint16_t width = layout->width > to ? layout->width : to;
+  uint16_t x1, y1;
 
-  pixelline_width = mgos_ili9341_getStringWidth(string);
-  if (pixelline_width == 0) {
-    LOG(LL_ERROR, ("getStringWidth returned 0 -- is the font set?"));
+  if (from >= to || height == 0) {
     return;
   }
-
-  lines = mgos_ili9341_getStringHeight(string);
-  if (lines == 0) {
-    LOG(LL_ERROR, ("getStringHeight returned 0 -- is the font set?"));
+  x0 += from;
+  if (x0 + s_window.x0 > s_window.x1 || y0 + s_window.y0 > s_window.y1) {
     return;
   }
-  //LOG(LL_DEBUG, ("string='%s' at (%d,%d), width=%u height=%u", string, x0, y0, pixelline_width, lines));
+  x1 = x0 + (to - from) - 1;
+  y1 = y0 + height - 1;
+  if (x1 + s_window.x0 > s_window.x1) {
+    x1 = s_window.x1 - s_window.x0;
+  }
+  if (y1 + s_window.y0 > s_window.y1) {
+    y1 = s_window.y1 - s_window.y0;
+  }
+
+  if (width > s_print.size) {
+    uint16_t *buf = ili9341_malloc(width * sizeof(uint16_t));
+    if (!buf) {
+      LOG(LL_ERROR, ("could not malloc line buffer of width=%u", width));
+      return;
+    }
+    free(s_print.buf);
+    s_print.buf  = buf;
+    s_print.size = width;
+  }
+
+  // The span goes out through one window, row after row. A row is rendered
+  // while the transmit pipeline sends out the previous ones.
+  ili9341_stream_begin(x0 + s_window.x0, y0 + s_window.y0, x1 + s_window.x0, y1 + s_window.y0);
+  for (uint16_t line = 0; line <= y1 - y0; line++) {
+    for (uint16_t i = 0; i < width; i++) {
+      s_print.buf[i] = s_window.bg_color;
+    }
+    for (size_t i = 0; colors && i < layout->nglyphs; i++) {
+      const struct ili9341_layout_glyph *lg = &layout->glyphs[i];
+      for (int32_t x = lg->pen; x < lg->pen + lg->xa && x < width; x++) {
+        s_print.buf[x] = colors[2 * i + 1];
+      }
+    }
+    if (line < layout->height) {
+      ili9341_print_fillPixelLine(layout, line, s_print.buf, s_window.fg_color, s_window.bg_color, colors);
+    }
+    ili9341_stream_write(s_print.buf + from, x1 - x0 + 1);
+  }
+  ili9341_stream_end();
+}
 
-  pixelline = calloc(pixelline_width, sizeof(uint16_t));
-  if (!pixelline) {
-    LOG(LL_ERROR, ("could not malloc for string='%s' at (%d,%d), width=%u height=%u", string, x0, y0, pixelline_width, lines));
+// Draws the foreground pixels of a laid out string placed at (x0,y0) in the
+// window, as one window per horizontal run of pixels. Runs are found on the
+// rendered row, so they continue across glyphs. Partially covered pixels of
+// anti-aliased glyphs are drawn in the foreground color.
+static void ili9341_print_runs(uint16_t x0, uint16_t y0, const struct ili9341_layout *layout) {
+  uint16_t fg = s_window.fg_color;
+  uint16_t bg = ~fg; // Any color but fg marks background pixels
+
+  if (x0 + s_window.x0 > s_window.x1) {
     return;
   }
+  if (layout->width > s_print.size) {
+    uint16_t *buf = ili9341_malloc(layout->width * sizeof(uint16_t));
+    if (!buf) {
+      LOG(LL_ERROR, ("could not malloc line buffer of width=%u", layout->width));
+      return;
+    }
+    free(s_print.buf);
+    s_print.buf  = buf;
+    s_print.size = layout->width;
+  }
+
+  for (uint16_t line = 0; line < layout->height && y0 + line + s_window.y0 <= s_window.y1; line++) {
+    for (uint16_t i = 0; i < layout->width; i++) {
+      s_print.buf[i] = bg;
+    }
+    ili9341_print_fillPixelLine(layout, line, s_print.buf, fg, bg, NULL);
+    for (uint16_t i = 0; i < layout->width;) {
+      uint16_t from;
+      if (s_print.buf[i] == bg) {
+        i++;
+        continue;
+      }
+      from = i;
+      while (i < layout->width && s_print.buf[i] != bg) {
+        i++;
+      }
+      ili9341_fill_clipped(x0 + from, y0 + line, x0 + i - 1, y0 + line);
+    }
+  }
+}
+
+void ili9341_get_window_origin(uint16_t *x0, uint16_t *y0) {
+  *x0 = s_window.x0;
+  *y0 = s_window.y0;
+}
+
+void ili9341_get_colors(uint16_t *fg, uint16_t *bg) {
+  *fg = s_window.fg_color;
+  *bg = s_window.bg_color;
+}
+
+// Formats into the caller's buffer, truncating output that does not fit at
+// a character boundary. Returns false on a format error.
+bool ili9341_vformat(char *buf, size_t size, const char *fmt, va_list ap) {
+  static bool logged = false;
+  int         n      = vsnprintf(buf, size, fmt, ap);
+
+  if (n < 0) {
+    buf[0] = '\0';
+    return false;
+  }
+  if ((size_t)n >= size) {
+    size_t  len = size - 1, lead = len;
+    uint8_t c;
 
-  for (int line = 0; line < mgos_ili9341_getStringHeight(string); line++) {
-    int ret;
-    for (int i = 0; i < pixelline_width; i++) {
-      pixelline[i] = s_window.bg_color;
+    // Drop a UTF-8 sequence that was cut short
+    while (lead > 0 && ((uint8_t)buf[lead - 1] & 0xC0) == 0x80) {
+      lead--;
+    }
+    c = lead > 0 ? (uint8_t)buf[lead - 1] : 0;
+    if (c >= 0xC0 && len - (lead - 1) < (c >= 0xF0 ? 4u : c >= 0xE0 ? 3u : 2u)) {
+      len = lead - 1;
     }
-    ret = ili9341_print_fillPixelLine(string, line, pixelline, s_window.fg_color);
-    if (ret != pixelline_width) {
-      LOG(LL_ERROR, ("ili9341_getStringPixelLine returned %d, but we expected %d", ret, pixelline_width));
+    buf[len] = '\0';
+    if (!logged) {
+      LOG(LL_WARN, ("printf output of %d bytes truncated to %u", n, (unsigned)len));
+      logged = true;
     }
-    ili9341_send_pixels(x0, y0 + line, x0 + pixelline_width - 1, y0 + line, (uint8_t *)pixelline, pixelline_width * sizeof(uint16_t));
   }
-  free(pixelline);
+  return true;
+}
+
+void mgos_ili9341_print(uint16_t x0, uint16_t y0, const char *string) {
+  const struct ili9341_layout *layout = ili9341_print_layout(string);
+
+  if (!layout || layout->width == 0 || layout->height == 0) {
+    LOG(LL_ERROR, ("string has no extent -- is the font set?"));
+    return;
+  }
+  //LOG(LL_DEBUG, ("string='%s' at (%d,%d), width=%u height=%u", string, x0, y0, layout->width, layout->height));
+  if (s_window.transparent_text) {
+    ili9341_print_runs(x0, y0, layout);
+  } else {
+    ili9341_print_span(x0, y0, layout, 0, layout->width, layout->height, NULL);
+  }
 }
 
 void mgos_ili9341_printf(uint16_t x0, uint16_t y0, const char *fmt, ...) {
-  char buf[50], *s = buf;
+  char    buf[ILI9341_PRINTF_BUF_SIZE];
+  bool    ok;
   va_list ap;
+
   va_start(ap, fmt);
-  if (mg_avprintf(&s, sizeof(buf), fmt, ap) > 0) {
-    mgos_ili9341_print(x0, y0, s);
-  }
+  ok = ili9341_vformat(buf, sizeof(buf), fmt, ap);
   va_end(ap);
-  if (s != buf) free(s);
+  if (ok) {
+    mgos_ili9341_print(x0, y0, buf);
+  }
+}
+
+void mgos_ili9341_fence(void) {
+  ili9341_tx_flush();
+}
+
+bool mgos_ili9341_set_framebuffer(bool enable) {
+  if (!enable) {
+    if (s_fb.buf) {
+      ili9341_fb_flush();
+      ili9341_fb_free();
+    }
+    return true;
+  }
+  return ili9341_fb_alloc();
+}
+
+// Bands are drawn into s_band.buf, which is temporarily installed as the
+// framebuffer, covering rows [y0, y0 + height) of the screen.
+bool mgos_ili9341_render_bands(mgos_ili9341_draw_cb_t draw, void *arg) {
+  struct ili9341_window window = s_window;
+  uint16_t              height = mgos_sys_config_get_ili9341_band_height();
+
+  if (!draw) {
+    return false;
+  }
+  if (s_fb.buf) {
+    // Already drawing into a full framebuffer, which is the single band
+    uint32_t n = (uint32_t)s_fb.width * s_fb.height;
+
+    for (uint32_t i = 0; i < n; i++) {
+      s_fb.buf[i] = window.bg_color;
+    }
+    ili9341_fb_mark(0, 0, s_fb.width - 1, s_fb.height - 1);
+    s_window = window;
+    draw(arg);
+    mgos_ili9341_flush();
+    s_window = window;
+    return true;
+  }
+  if (height == 0 || height > s_screen_height) {
+    height = s_screen_height;
+  }
+  if (s_band.buf && (s_band.width != s_screen_width || s_band.height != height)) {
+    free(s_band.buf);
+    s_band.buf = NULL;
+  }
+  if (!s_band.buf) {
+    if (!(s_band.buf = ili9341_malloc((uint32_t)s_screen_width * height * sizeof(uint16_t)))) {
+      LOG(LL_ERROR, ("Could not allocate %ux%u band buffer", s_screen_width, height));
+      return false;
+    }
+    s_band.width  = s_screen_width;
+    s_band.height = height;
+  }
+
+  s_fb.buf   = s_band.buf;
+  s_fb.width = s_band.width;
+  s_fb.band  = true;
+  for (uint16_t y0 = 0; y0 < s_screen_height; y0 += height) {
+    uint32_t n = (uint32_t)s_fb.width * height;
+
+    s_fb.y0     = y0;
+    s_fb.height = (y0 + height > s_screen_height ? s_screen_height - y0 : height);
+    for (uint32_t i = 0; i < n; i++) {
+      s_band.buf[i] = window.bg_color;
+    }
+    s_window = window;
+    draw(arg);
+
+    ili9341_set_clip(0, y0, s_fb.width - 1, y0 + s_fb.height - 1);
+    ili9341_tx_write((uint8_t *)s_band.buf, (uint32_t)s_fb.width * s_fb.height * sizeof(uint16_t));
+    ili9341_tx_flush();
+  }
+  memset(&s_fb, 0, sizeof(s_fb));
+  s_window = window;
+  return true;
+}
+
+void mgos_ili9341_flush(void) {
+  if (s_fb.buf) {
+    ili9341_fb_flush();
+  }
+  ili9341_tx_flush();
+}
+
+void mgos_ili9341_get_stats(struct mgos_ili9341_stats *stats) {
+  if (stats) {
+    *stats = s_stats;
+  }
+}
+
+struct mgos_ili9341_stats *ili9341_stats(void) {
+  return &s_stats;
+}
+
+void mgos_ili9341_reset_stats(void) {
+  memset(&s_stats, 0, sizeof(s_stats));
 }
 
 uint16_t mgos_ili9341_get_screenWidth() {
@@ -518,47 +1835,502 @@ uint16_t mgos_ili9341_get_screenHeight() {
   return s_screen_height;
 }
 
+// Clips an image of w by h pixels at (x0, y0) in the window up front, so
+// that rows below it are never read, and neither are rows outside of the
+// band being rendered. Sets the part that can be seen: the first *visible
+// pixels of image rows *first to *last. Returns false if there is none.
+static bool ili9341_image_clip(uint16_t x0, uint16_t y0, uint32_t w, uint32_t h, uint32_t *visible, uint32_t *first, uint32_t *last) {
+  uint16_t sy0, sy1;
+
+  if (w == 0 || h == 0 || x0 + s_window.x0 > s_window.x1 || y0 + s_window.y0 > s_window.y1) {
+    return false;
+  }
+  *visible = w;
+  if (x0 + w - 1 + s_window.x0 > s_window.x1) {
+    *visible = s_window.x1 - s_window.x0 - x0 + 1;
+  }
+  sy0 = y0 + s_window.y0;
+  sy1 = (sy0 + h - 1 > s_window.y1) ? s_window.y1 : sy0 + h - 1;
+  if (!ili9341_stream_rows(&sy0, &sy1)) {
+    return false;
+  }
+  *first = sy0 - y0 - s_window.y0;
+  *last  = sy1 - y0 - s_window.y0;
+  return true;
+}
+
+// Opens a stream for the part of an image set by ili9341_image_clip().
+static void ili9341_image_begin(uint16_t x0, uint16_t y0, uint32_t visible, uint32_t first, uint32_t last) {
+  ili9341_stream_begin(x0 + s_window.x0, y0 + s_window.y0 + first, x0 + s_window.x0 + visible - 1, y0 + s_window.y0 + last);
+}
+
+// DIF images -- function names start with ili9341_dif_ and are all
+// declared static.
+#define ILI9341_DIF_HDR_SIZE    16
+#define ILI9341_DIF_BUF_MIN     64
+#define ILI9341_DIF_RAW         0 // Pixel format: RGB565 in network byte order
+#define ILI9341_DIF_RLE         1 // Pixel format: runs of RGB565 pixels, see README.md
+
+// Image being drawn, and the part of it that falls in the window: the
+// first 'visible' pixels of rows first to last.
+struct ili9341_dif {
+  const char *fn;
+  int         fd;
+  uint8_t *   buf;
+  uint32_t    size; // Of buf
+  uint32_t    len;  // Bytes read into buf
+  uint32_t    pos;  // Bytes of buf consumed
+  uint32_t    w;
+  uint32_t    h;
+  uint32_t    visible;
+  uint32_t    first;
+  uint32_t    last;
+};
+
+// Raw images are read in blocks of up to size bytes, which end on multiples
+// of size in the file. Pixels outside of the window are skipped in the
+// buffer, or with a seek when a whole block of them would be read.
+static bool ili9341_dif_raw(struct ili9341_dif *d) {
+  uint32_t row     = d->w * sizeof(uint16_t);
+  uint32_t visible = d->visible * sizeof(uint16_t);
+  uint32_t pos     = ILI9341_DIF_HDR_SIZE + d->first * row;
+  uint32_t end     = pos + (d->last - d->first) * row + visible;
+  uint32_t row_pos = 0;
+
+  if (lseek(d->fd, pos, SEEK_SET) < 0) {
+    return false;
+  }
+  while (pos < end) {
+    uint32_t len = d->size - pos % d->size;
+
+    if (row_pos >= visible && row - row_pos >= d->size) {
+      pos    += row - row_pos;
+      row_pos = 0;
+      if (lseek(d->fd, pos, SEEK_SET) < 0) {
+        return false;
+      }
+      continue;
+    }
+    if (len > end - pos) {
+      len = end - pos;
+    }
+    if ((int)len != read(d->fd, d->buf, len)) {
+      return false;
+    }
+    pos += len;
+    if (visible == row) {
+      ili9341_stream_write((uint16_t *)d->buf, len / sizeof(uint16_t));
+      continue;
+    }
+    for (uint32_t i = 0, n; i < len; i += n, row_pos += n) {
+      if (row_pos == row) {
+        row_pos = 0;
+      }
+      if (row_pos < visible) {
+        n = visible - row_pos;
+        n = n < len - i ? n : len - i;
+        ili9341_stream_write((uint16_t *)(d->buf + i), n / sizeof(uint16_t));
+      } else {
+        n = row - row_pos;
+        n = n < len - i ? n : len - i;
+      }
+    }
+  }
+  return true;
+}
+
+// Copies the next n bytes of the file into dst, or skips them if dst is
+// NULL, reading blocks of up to size bytes as needed.
+static bool ili9341_dif_read(struct ili9341_dif *d, uint8_t *dst, uint32_t n) {
+  while (n > 0) {
+    uint32_t len;
+
+    if (d->pos == d->len) {
+      int ret = read(d->fd, d->buf, d->size);
+      if (ret <= 0) {
+        return false;
+      }
+      d->len = ret;
+      d->pos = 0;
+    }
+    len = d->len - d->pos < n ? d->len - d->pos : n;
+    if (dst) {
+      memcpy(dst, d->buf + d->pos, len);
+      dst += len;
+    }
+    d->pos += len;
+    n      -= len;
+  }
+  return true;
+}
+
+// Copies n literal pixels from the file to the stream, straight into the
+// transmit buffers (or the framebuffer).
+static bool ili9341_dif_pixels(struct ili9341_dif *d, uint32_t n) {
+  for (uint32_t len; n > 0; n -= len) {
+    uint16_t *buf;
+
+    len = n;
+    if (!(buf = ili9341_stream_reserve(&len))) {
+      return false;
+    }
+    if (!ili9341_dif_read(d, (uint8_t *)buf, len * sizeof(uint16_t))) {
+      return false;
+    }
+    ili9341_stream_commit(len);
+  }
+  return true;
+}
+
+// Decodes an RLE image, which only needs the read buffer. Rows above the
+// visible ones are decoded without drawing them, rows below are not read.
+static bool ili9341_dif_rle(struct ili9341_dif *d) {
+  for (uint32_t y = 0; y <= d->last; y++) {
+    uint32_t visible = y >= d->first ? d->visible : 0;
+
+    for (uint32_t x = 0, n, vis; x < d->w; x += n) {
+      uint8_t run[3];
+
+      if (!ili9341_dif_read(d, run, 1)) {
+        return false;
+      }
+      n = run[0] < 128 ? run[0] + 1 : run[0] - 126;
+      if (x + n > d->w) {
+        return false; // Runs do not cross rows
+      }
+      vis = x >= visible ? 0 : (x + n > visible ? visible - x : n);
+      if (run[0] >= 128) {
+        uint16_t color;
+        if (!ili9341_dif_read(d, run + 1, 2)) {
+          return false;
+        }
+        memcpy(&color, run + 1, sizeof(color));
+        ili9341_stream_fill(color, vis);
+      } else if (!ili9341_dif_pixels(d, vis) || !ili9341_dif_read(d, NULL, (n - vis) * sizeof(uint16_t))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 void mgos_ili9341_drawDIF(uint16_t x0, uint16_t y0, char *fn) {
-  uint16_t *pixelline = NULL;
-  uint8_t   dif_hdr[16];
-  uint32_t  w, h;
-  int       fd;
+  struct ili9341_dif d;
+  uint8_t            dif_hdr[ILI9341_DIF_HDR_SIZE];
+  bool               rle;
 
-  fd = open(fn, O_RDONLY);
+  memset(&d, 0, sizeof(d));
+  d.fn = fn;
+  d.fd = open(fn, O_RDONLY);
    // has to be tested not only for NULL
-  if (fd < 0) {
+  if (d.fd < 0) {
     LOG(LL_ERROR, ("%s: Could not open", fn));
     goto exit;
   }
-  if (16 != read(fd, dif_hdr, 16)) {
+  if (ILI9341_DIF_HDR_SIZE != read(d.fd, dif_hdr, ILI9341_DIF_HDR_SIZE)) {
     LOG(LL_ERROR, ("%s: Could not read DIF header", fn));
     goto exit;
   }
-  if (dif_hdr[0] != 'D' || dif_hdr[1] != 'I' || dif_hdr[2] != 'F' || dif_hdr[3] != 1) {
+  // Version 1 files are raw, version 2 files name their pixel format.
+  if (dif_hdr[0] != 'D' || dif_hdr[1] != 'I' || dif_hdr[2] != 'F' || dif_hdr[3] < 1 || dif_hdr[3] > 2 ||
+      (dif_hdr[3] == 2 && dif_hdr[12] != ILI9341_DIF_RAW && dif_hdr[12] != ILI9341_DIF_RLE)) {
     LOG(LL_ERROR, ("%s: Invalid DIF header", fn));
     goto exit;
   }
-  w = dif_hdr[7] + (dif_hdr[6] << 8) + (dif_hdr[5] << 16) + (dif_hdr[4] << 24);
-  h = dif_hdr[11] + (dif_hdr[10] << 8) + (dif_hdr[9] << 16) + (dif_hdr[8] << 24);
-  LOG(LL_DEBUG, ("%s: width=%d height=%d", fn, (int)w, (int)h));
-  pixelline = calloc(w, sizeof(uint16_t));
+  rle = dif_hdr[3] == 2 && dif_hdr[12] == ILI9341_DIF_RLE;
+  d.w = dif_hdr[7] + (dif_hdr[6] << 8) + (dif_hdr[5] << 16) + (dif_hdr[4] << 24);
+  d.h = dif_hdr[11] + (dif_hdr[10] << 8) + (dif_hdr[9] << 16) + (dif_hdr[8] << 24);
+  LOG(LL_DEBUG, ("%s: width=%d height=%d%s", fn, (int)d.w, (int)d.h, rle ? " rle" : ""));
+  if (!ili9341_image_clip(x0, y0, d.w, d.h, &d.visible, &d.first, &d.last)) {
+    goto exit;
+  }
+  d.size = mgos_sys_config_get_ili9341_dif_buf_size() & ~1;
+  if (d.size < ILI9341_DIF_BUF_MIN) {
+    d.size = ILI9341_DIF_BUF_MIN;
+  }
+  if (!(d.buf = ili9341_malloc(d.size))) {
+    LOG(LL_ERROR, ("%s: Could not malloc %u bytes", fn, (unsigned)d.size));
+    goto exit;
+  }
+
+  // The visible part goes out through one window.
+  ili9341_image_begin(x0, y0, d.visible, d.first, d.last);
+  if (!(rle ? ili9341_dif_rle(&d) : ili9341_dif_raw(&d))) {
+    LOG(LL_ERROR, ("%s: short read or corrupt image", fn));
+  }
+
+exit:
+  ili9341_stream_end();
+  free(d.buf);
+  if (d.fd >= 0) {
+    close(d.fd);
+  }
+}
+
+// PNG images -- decoded by upng one scanline at a time, which is converted
+// straight into the transmit buffers. Function names start with
+// ili9341_png_ and are all declared static.
+struct ili9341_png {
+  int      fd;
+  uint32_t bpp;    // Bytes per pixel
+  uint32_t sample; // Bytes per sample, the first one is the most significant
+  bool     gray;
+  uint32_t visible;
+  uint32_t first;
+  uint32_t last;
+};
+
+static int ili9341_png_read(void *arg, unsigned char *buf, unsigned len) {
+  return read(((struct ili9341_png *)arg)->fd, buf, len);
+}
+
+// Sends the visible pixels of the rows that can be seen, and stops the
+// decoder after the last of them. Alpha is ignored, as in png2dif.
+static int ili9341_png_row(void *arg, unsigned y, const unsigned char *row) {
+  struct ili9341_png *p = (struct ili9341_png *)arg;
+
+  if (y < p->first) {
+    return 1;
+  }
+  for (uint32_t x = 0, len; x < p->visible; x += len) {
+    uint16_t *buf;
+
+    len = p->visible - x;
+    if (!(buf = ili9341_stream_reserve(&len))) {
+      return 0;
+    }
+    for (uint32_t i = 0; i < len; i++) {
+      const unsigned char *px = row + (x + i) * p->bpp;
+      uint8_t              r  = px[0];
+      uint8_t              g  = p->gray ? r : px[p->sample];
+      uint8_t              b  = p->gray ? r : px[2 * p->sample];
+
+      buf[i] = htons(mgos_ili9341_color565(r, g, b));
+    }
+    ili9341_stream_commit(len);
+  }
+  return y < p->last;
+}
+
+void mgos_ili9341_drawPNG(uint16_t x0, uint16_t y0, char *fn) {
+  struct ili9341_png p;
+  upng_t *           upng = NULL;
+  uint32_t           w, h;
+
+  memset(&p, 0, sizeof(p));
+  p.fd = open(fn, O_RDONLY);
+  if (p.fd < 0) {
+    LOG(LL_ERROR, ("%s: Could not open", fn));
+    goto exit;
+  }
+  if (!(upng = upng_new_from_stream(ili9341_png_read, &p)) || upng_header(upng) != UPNG_EOK) {
+    LOG(LL_ERROR, ("%s: Invalid PNG header", fn));
+    goto exit;
+  }
+  switch (upng_get_format(upng)) {
+  case UPNG_RGB8:
+  case UPNG_RGBA8:
+  case UPNG_RGB16:
+  case UPNG_RGBA16:
+  case UPNG_LUMINANCE8:
+  case UPNG_LUMINANCE_ALPHA8:
+    break;
+
+  default:
+    LOG(LL_ERROR, ("%s: Unsupported PNG format (%d)", fn, upng_get_format(upng)));
+    goto exit;
+  }
+  p.bpp    = upng_get_bpp(upng) / 8;
+  p.sample = upng_get_bitdepth(upng) / 8;
+  p.gray   = upng_get_components(upng) < 3;
+  w        = upng_get_width(upng);
+  h        = upng_get_height(upng);
+  LOG(LL_DEBUG, ("%s: width=%d height=%d format=%d", fn, (int)w, (int)h, upng_get_format(upng)));
+  if (!ili9341_image_clip(x0, y0, w, h, &p.visible, &p.first, &p.last)) {
+    goto exit;
+  }
+
+  // Rows above the visible ones have to be decoded, rows below them are not.
+  ili9341_image_begin(x0, y0, p.visible, p.first, p.last);
+  if (upng_decode_rows(upng, ili9341_png_row, &p) != UPNG_EOK) {
+    LOG(LL_ERROR, ("%s: PNG decode error %d", fn, upng_get_error(upng)));
+  }
+
+exit:
+  ili9341_stream_end();
+  if (upng) {
+    upng_free(upng);
+  }
+  if (p.fd >= 0) {
+    close(p.fd);
+  }
+}
+
+// Recordings -- a header of "REC" and the version, followed by the entries
+// recorded by ili9341_rec_cmd(). Replaying sends each command as one
+// transaction and all of its data as another, however many writes it was
+// made of when it was recorded.
+static uint32_t ili9341_rec_entry_len(const uint8_t *hdr) {
+  return hdr[4] + (hdr[3] << 8) + (hdr[2] << 16) + ((uint32_t)hdr[1] << 24);
+}
+
+static bool ili9341_rec_valid(const uint8_t *rec, size_t len) {
+  size_t pos = ILI9341_REC_HDR_SIZE;
+
+  if (!rec || len < ILI9341_REC_HDR_SIZE || memcmp(rec, "REC\x01", ILI9341_REC_HDR_SIZE) != 0) {
+    return false;
+  }
+  while (pos < len) {
+    if (len - pos < ILI9341_REC_ENTRY_HDR || ili9341_rec_entry_len(rec + pos) > len - pos - ILI9341_REC_ENTRY_HDR ||
+        !ili9341_rec_allowed(rec[pos])) {
+      return false;
+    }
+    pos += ILI9341_REC_ENTRY_HDR + ili9341_rec_entry_len(rec + pos);
+  }
+  return true;
+}
+
+// Whatever was drawn before goes out first, and the address window is
+// forgotten, so that the recording programs all of it.
+bool mgos_ili9341_record_start(void) {
+  if (s_rec.active) {
+    return false;
+  }
+  mgos_ili9341_flush();
+  memset(&s_rec, 0, sizeof(s_rec));
+  if (!ili9341_rec_reserve(ILI9341_REC_HDR_SIZE)) {
+    memset(&s_rec, 0, sizeof(s_rec));
+    return false;
+  }
+  memcpy(s_rec.buf, "REC\x01", ILI9341_REC_HDR_SIZE);
+  s_rec.len = ILI9341_REC_HDR_SIZE;
+  ili9341_clip_invalidate();
+  s_rec.active = true;
+  return true;
+}
+
+uint8_t *mgos_ili9341_record_stop(size_t *len) {
+  uint8_t *rec = NULL;
+
+  if (len) {
+    *len = 0;
+  }
+  if (!s_rec.active) {
+    return NULL;
+  }
+  mgos_ili9341_flush();
+  ili9341_rec_close();
+  if (s_rec.failed) {
+    free(s_rec.buf);
+  } else {
+    rec = s_rec.buf;
+    if (len) {
+      *len = s_rec.len;
+    }
+  }
+  memset(&s_rec, 0, sizeof(s_rec));
+  return rec;
+}
+
+bool mgos_ili9341_record_stop_file(const char *fn) {
+  size_t   len;
+  uint8_t *rec = mgos_ili9341_record_stop(&len);
+  bool     ok  = false;
+  int      fd;
+
+  if (!rec) {
+    return false;
+  }
+  if ((fd = open(fn, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+    LOG(LL_ERROR, ("%s: Could not open", fn));
+  } else {
+    ok = write(fd, rec, len) == (ssize_t)len;
+    if (!ok) {
+      LOG(LL_ERROR, ("%s: Could not write %u bytes", fn, (unsigned)len));
+    }
+    close(fd);
+  }
+  free(rec);
+  return ok;
+}
+
+// The recording is checked as a whole first, so that a corrupt one does
+// not leave a half written window behind.
+bool mgos_ili9341_replay(const uint8_t *rec, size_t len) {
+  if (!ili9341_rec_valid(rec, len)) {
+    LOG(LL_ERROR, ("Invalid recording"));
+    return false;
+  }
+  mgos_ili9341_flush();
+  for (size_t pos = ILI9341_REC_HDR_SIZE; pos < len;) {
+    uint32_t n = ili9341_rec_entry_len(rec + pos);
 
-  for (uint16_t yy = 0; yy < h; yy++) {
-    if (w * 2 != (uint16_t)read(fd, pixelline, w * 2)) {
-      LOG(LL_ERROR, ("%s: short read", fn));
+    ili9341_spi_write_cmd(rec[pos], NULL, 0);
+    if (n > 0) {
+      ili9341_spi_write_data(rec + pos + ILI9341_REC_ENTRY_HDR, n);
+    }
+    pos += ILI9341_REC_ENTRY_HDR + n;
+  }
+  ili9341_clip_invalidate();
+  return true;
+}
+
+// Data is read in blocks of ili9341.dif_buf_size bytes, as for DIF images,
+// and each block is sent as it is. A command that the recording could not
+// have held ends the replay before it is sent.
+bool mgos_ili9341_replay_file(const char *fn) {
+  uint8_t  hdr[ILI9341_REC_ENTRY_HDR];
+  uint8_t *buf  = NULL;
+  uint32_t size = mgos_sys_config_get_ili9341_dif_buf_size();
+  bool     ok   = false;
+  int      fd;
+  ssize_t  r;
+
+  if (size < ILI9341_DIF_BUF_MIN) {
+    size = ILI9341_DIF_BUF_MIN;
+  }
+  if ((fd = open(fn, O_RDONLY)) < 0) {
+    LOG(LL_ERROR, ("%s: Could not open", fn));
+    return false;
+  }
+  if (!(buf = ili9341_malloc(size))) {
+    LOG(LL_ERROR, ("%s: Could not malloc %u bytes", fn, (unsigned)size));
+    close(fd);
+    return false;
+  }
+  if (read(fd, hdr, ILI9341_REC_HDR_SIZE) != ILI9341_REC_HDR_SIZE || memcmp(hdr, "REC\x01", ILI9341_REC_HDR_SIZE) != 0) {
+    LOG(LL_ERROR, ("%s: Invalid recording header", fn));
+    free(buf);
+    close(fd);
+    return false;
+  }
+  mgos_ili9341_flush();
+  while ((r = read(fd, hdr, ILI9341_REC_ENTRY_HDR)) == ILI9341_REC_ENTRY_HDR) {
+    uint32_t n = ili9341_rec_entry_len(hdr);
+
+    if (!ili9341_rec_allowed(hdr[0])) {
       goto exit;
     }
-    ili9341_send_pixels(x0, y0 + yy, x0 + w - 1, y0 + yy, (uint8_t *)pixelline, w * sizeof(uint16_t));
-    if (y0 + yy > s_window.y1) {
-      break;
+    ili9341_spi_write_cmd(hdr[0], NULL, 0);
+    while (n > 0) {
+      r = read(fd, buf, n < size ? n : size);
+      if (r <= 0) {
+        goto exit;
+      }
+      ili9341_spi_write_data(buf, r);
+      n -= r;
     }
   }
+  ok = r == 0;
 
 exit:
-  if (pixelline) {
-    free(pixelline);
+  if (!ok) {
+    LOG(LL_ERROR, ("%s: short read or corrupt recording", fn));
   }
+  ili9341_clip_invalidate();
+  free(buf);
   close(fd);
+  return ok;
 }
 
 bool mgos_ili9341_spi_init(void) {
@@ -582,10 +2354,18 @@ bool mgos_ili9341_spi_init(void) {
     mgos_gpio_write(mgos_sys_config_get_ili9341_rst_pin(), 1);
   }
 
+  ili9341_spi_init();
+  ili9341_tx_init();
+  ili9341_fill_init();
   ili9341_commandList(ILI9341_init);
+  ili9341_clip_invalidate();
 
   mgos_ili9341_set_dimensions(mgos_sys_config_get_ili9341_width(), mgos_sys_config_get_ili9341_height());
   mgos_ili9341_set_rotation(ILI9341_LANDSCAPE);
 
+  if (mgos_sys_config_get_ili9341_framebuffer()) {
+    mgos_ili9341_set_framebuffer(true);
+  }
+
   return true;
 }
@@ -0,0 +1,201 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mgos_ili9341.h"
+
+#include "mgos_ili9341_hal.h"
+
+// A strip chart shows its last 'width' samples, one column each, and keeps
+// the one before them for the trace into the oldest column. A new
+// sample is composed into a column buffer (background, grid and the trace
+// from the previous sample) and sent as one narrow window. Charts that span
+// the screen across the scroll axis scroll in hardware, with the newest
+// sample on the right. Others sweep: samples are written left to right,
+// wrapping around, with a blank column ahead of the newest one.
+struct mgos_ili9341_chart {
+  uint16_t  x0;
+  uint16_t  y0;
+  uint16_t  width;
+  uint16_t  height;
+  int32_t   min;
+  int32_t   max;
+  uint16_t  fg;           // Colors, in network byte order
+  uint16_t  bg;
+  uint16_t  grid;
+  uint16_t  grid_rows;    // Pixels between horizontal grid lines, 0 for none
+  uint16_t  grid_samples; // Samples between vertical grid lines, 0 for none
+  uint16_t *rows;         // Row of each of the last 'width' + 1 samples
+  uint16_t *buf;          // Column buffer, two columns wide
+  uint32_t  n;            // Samples added
+  bool      drawn;
+  bool      hw;
+};
+
+// Composes the column of sample s into buf, every stride pixels. Gap columns
+// (s < 0) only have the background and the horizontal grid, as do columns
+// of samples that are no longer shown.
+static void ili9341_chart_column(const struct mgos_ili9341_chart *c, int64_t s, uint16_t *buf, uint16_t stride) {
+  bool vgrid = s >= 0 && c->grid_samples > 0 && s % c->grid_samples == 0;
+
+  for (uint16_t y = 0; y < c->height; y++) {
+    bool hgrid = c->grid_rows > 0 && (c->height - 1 - y) % c->grid_rows == 0;
+    buf[y * stride] = (vgrid || hgrid) ? c->grid : c->bg;
+  }
+  if (s < 0 || s >= c->n || s + c->width < c->n) {
+    return;
+  }
+  // The trace joins the previous sample with a vertical run
+  uint16_t y0 = c->rows[s % (c->width + 1)];
+  uint16_t y1 = s > 0 ? c->rows[(s - 1) % (c->width + 1)] : y0;
+  if (y0 > y1) {
+    uint16_t t = y0;
+    y0 = y1;
+    y1 = t;
+  }
+  for (uint16_t y = y0; y <= y1; y++) {
+    buf[y * stride] = c->fg;
+  }
+}
+
+// Sample shown in column x, or -1 for the sweep gap and empty columns.
+static int64_t ili9341_chart_sample(const struct mgos_ili9341_chart *c, uint16_t x) {
+  if (c->hw) {
+    return (int64_t)c->n - c->width + x;
+  }
+  if (x == c->n % c->width) {
+    return -1;
+  }
+  return (int64_t)c->n - 1 - (int64_t)((c->n - 1 + c->width - x) % c->width);
+}
+
+// Whether the chart can scroll with the display: it has to span the screen
+// across the scroll axis, which is then x.
+static bool ili9341_chart_hw(const struct mgos_ili9341_chart *c) {
+  uint16_t wx0, wy0;
+
+  ili9341_get_window_origin(&wx0, &wy0);
+  if (wy0 + c->y0 != 0 || c->height != mgos_ili9341_get_screenHeight() || mgos_ili9341_get_scroll_vertical()) {
+    return false;
+  }
+  return ili9341_scroll_claim(c, wx0 + c->x0, wx0 + c->x0 + c->width - 1);
+}
+
+static void ili9341_chart_draw(struct mgos_ili9341_chart *c) {
+  c->hw = ili9341_chart_hw(c);
+  for (uint16_t x = 0; x < c->width; x++) {
+    ili9341_chart_column(c, ili9341_chart_sample(c, x), c->buf, 1);
+    ili9341_write_clipped(c->x0 + x, c->y0, c->x0 + x, c->y0 + c->height - 1, c->buf);
+  }
+  c->drawn = true;
+}
+
+struct mgos_ili9341_chart *mgos_ili9341_chart_create(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height, int32_t min, int32_t max) {
+  struct mgos_ili9341_chart *c;
+
+  if (width < 2 || height == 0 || min >= max) {
+    return NULL;
+  }
+  c = ili9341_malloc(sizeof(*c));
+  if (!c) {
+    return NULL;
+  }
+  memset(c, 0, sizeof(*c));
+  c->rows = ili9341_malloc((width + 1) * sizeof(uint16_t));
+  c->buf  = ili9341_malloc(2 * height * sizeof(uint16_t));
+  if (!c->rows || !c->buf) {
+    LOG(LL_ERROR, ("could not malloc chart of %ux%u", width, height));
+    mgos_ili9341_chart_destroy(c);
+    return NULL;
+  }
+  c->x0     = x0;
+  c->y0     = y0;
+  c->width  = width;
+  c->height = height;
+  c->min    = min;
+  c->max    = max;
+  ili9341_get_colors(&c->fg, &c->bg);
+  c->grid = c->fg;
+  return c;
+}
+
+void mgos_ili9341_chart_set_grid(struct mgos_ili9341_chart *c, uint16_t rows, uint16_t samples, uint16_t color) {
+  if (!c) {
+    return;
+  }
+  c->grid_rows    = rows;
+  c->grid_samples = samples;
+  c->grid         = htons(color);
+  c->drawn        = false;
+}
+
+void mgos_ili9341_chart_add(struct mgos_ili9341_chart *c, int32_t value) {
+  uint16_t x, w;
+
+  if (!c) {
+    return;
+  }
+  if (value < c->min) {
+    value = c->min;
+  }
+  if (value > c->max) {
+    value = c->max;
+  }
+  c->rows[c->n % (c->width + 1)] = (c->height - 1) - ((int64_t)value - c->min) * (c->height - 1) / ((int64_t)c->max - c->min);
+  c->n++;
+  // The area went away with a change of rotation
+  if (c->drawn && c->hw && !ili9341_scroll_owned(c)) {
+    c->drawn = false;
+  }
+  if (!c->drawn) {
+    ili9341_chart_draw(c);
+    return;
+  }
+
+  if (c->hw) {
+    mgos_ili9341_scroll(1);
+    x = c->width - 1;
+    w = 1;
+  } else {
+    // The new sample, and the gap after it if that is the next column
+    x = (c->n - 1) % c->width;
+    w = x + 1 < c->width ? 2 : 1;
+  }
+  ili9341_chart_column(c, c->n - 1, c->buf, w);
+  if (w == 2) {
+    ili9341_chart_column(c, -1, c->buf + 1, w);
+  }
+  ili9341_write_clipped(c->x0 + x, c->y0, c->x0 + x + w - 1, c->y0 + c->height - 1, c->buf);
+  if (!c->hw && w == 1) {
+    ili9341_chart_column(c, -1, c->buf, 1);
+    ili9341_write_clipped(c->x0, c->y0, c->x0, c->y0 + c->height - 1, c->buf);
+  }
+}
+
+void mgos_ili9341_chart_invalidate(struct mgos_ili9341_chart *c) {
+  if (c) {
+    c->drawn = false;
+  }
+}
+
+void mgos_ili9341_chart_destroy(struct mgos_ili9341_chart *c) {
+  if (!c) {
+    return;
+  }
+  ili9341_scroll_release(c);
+  free(c->rows);
+  free(c->buf);
+  free(c);
+}
@@ -0,0 +1,619 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mgos_ili9341.h"
+
+#include "mgos_ili9341_font.h"
+#include "mgos_ili9341_hal.h"
+
+#define ILI9341_CONSOLE_FG          16 // Color indexes of the console's own
+#define ILI9341_CONSOLE_BG          17 // colors, after the 16 ANSI colors
+#define ILI9341_CONSOLE_PARAMS_MAX  4
+#define ILI9341_CONSOLE_TAB         8
+
+// ANSI colors, normal and bright, in RGB565.
+static const uint16_t s_console_palette[16] = {
+  0x0000, 0xA800, 0x0540, 0xAAA0, 0x0015, 0xA815, 0x0555, 0xAD55,
+  0x52AA, 0xFAAA, 0x57EA, 0xFFEA, 0x52BF, 0xFABF, 0x57FF, 0xFFFF,
+};
+
+struct ili9341_console_cell {
+  uint32_t cp : 21;
+  uint32_t fg : 5;
+  uint32_t bg : 5;
+};
+
+enum ili9341_console_state {
+  ILI9341_CONSOLE_TEXT = 0,
+  ILI9341_CONSOLE_ESC,
+  ILI9341_CONSOLE_CSI,
+};
+
+// The backlog is a ring of rows, numbered from the first one ever written:
+// rows [end - count, end) are kept, row a in slot a % backlog. The last
+// 'rows' of them are the screen rows that the cursor moves in. Writing only
+// changes the backlog and marks rows dirty; the display is brought up to
+// date by mgos_ili9341_console_update(), from a timer, so that producers
+// never wait for the bus. Rows written faster than that are never drawn.
+struct mgos_ili9341_console {
+  uint16_t                     x0;
+  uint16_t                     y0;
+  uint16_t                     width;
+  uint16_t                     height;
+  const GFXfont *              font;
+  GFXfont                      font_copy; // Analyzed copy of a font without metrics
+  uint16_t                     rows;      // Screen rows
+  uint16_t                     cols;      // Cells per row
+  uint16_t                     backlog;   // Rows kept, screen rows included
+  struct ili9341_console_cell *cells;     // backlog * cols
+  uint16_t *                   len;       // Cells used in each slot
+  uint8_t *                    dirty;     // One byte per slot
+  uint32_t                     end;
+  uint32_t                     count;
+  uint32_t                     view;      // Rows scrolled back from the screen rows
+  uint32_t                     drawn_top; // First row shown by the last update
+  bool                         drawn;
+  bool                         hw;        // Scrolls with hardware scrolling
+
+  // Cursor, in screen rows and cells, and the pen position of the cell
+  uint16_t                     row;
+  uint16_t                     col;
+  uint16_t                     pen;
+  uint8_t                      fg;
+  uint8_t                      bg;
+  bool                         bold;
+  bool                         inverse;
+  uint16_t                     colors[2]; // Console's own fg and bg, RGB565
+
+  // Escape sequence and UTF-8 decoder state, kept across writes
+  enum ili9341_console_state   state;
+  uint16_t                     params[ILI9341_CONSOLE_PARAMS_MAX];
+  uint8_t                      nparams;
+  uint32_t                     utf8_cp;
+  uint8_t                      utf8_left;
+
+  mgos_timer_id                timer;
+  struct ili9341_layout        layout;     // Row being drawn
+  char *                       text;       // Its UTF-8, 4 bytes per cell
+  uint16_t *                   row_colors; // Its fg and bg per cell
+};
+
+static struct ili9341_console_cell *ili9341_console_row(struct mgos_ili9341_console *c, uint32_t a) {
+  return c->cells + (a % c->backlog) * c->cols;
+}
+
+// Absolute number of screen row r.
+static uint32_t ili9341_console_screen_row(const struct mgos_ili9341_console *c, uint16_t r) {
+  return c->end - c->rows + r;
+}
+
+static void ili9341_console_mark(struct mgos_ili9341_console *c, uint32_t a) {
+  c->dirty[a % c->backlog] = 1;
+}
+
+static uint16_t ili9341_console_advance(const struct mgos_ili9341_console *c, uint32_t cp) {
+  int32_t index = ili9341_font_glyph(c->font, cp);
+
+  return index < 0 ? 0 : c->font->glyph[index].xAdvance;
+}
+
+// Recomputes the pen position after the cursor moved. Cells past the end of
+// the row count as spaces, which is what they are filled with once written.
+static void ili9341_console_repen(struct mgos_ili9341_console *c) {
+  uint32_t                           a    = ili9341_console_screen_row(c, c->row);
+  const struct ili9341_console_cell *cell = ili9341_console_row(c, a);
+  uint16_t                           len  = c->len[a % c->backlog];
+  uint32_t                           pen  = 0;
+
+  for (uint16_t i = 0; i < c->col; i++) {
+    pen += ili9341_console_advance(c, i < len ? cell[i].cp : ' ');
+  }
+  c->pen = pen > UINT16_MAX ? UINT16_MAX : pen;
+}
+
+static void ili9341_console_clear_row(struct mgos_ili9341_console *c, uint32_t a) {
+  c->len[a % c->backlog] = 0;
+  ili9341_console_mark(c, a);
+}
+
+// Moves the cursor to the start of the next row, appending a row to the
+// backlog when it is on the last screen row. A backlog being viewed stays
+// where it is, until its rows are dropped.
+static void ili9341_console_newline(struct mgos_ili9341_console *c) {
+  c->col = 0;
+  c->pen = 0;
+  if (c->row + 1 < c->rows) {
+    c->row++;
+    return;
+  }
+  ili9341_console_clear_row(c, c->end);
+  c->end++;
+  if (c->count < c->backlog) {
+    c->count++;
+  }
+  if (c->view > 0 && c->view < c->count - c->rows) {
+    c->view++;
+  }
+}
+
+static void ili9341_console_put(struct mgos_ili9341_console *c, uint32_t cp) {
+  struct ili9341_console_cell *cell;
+  uint32_t                     a;
+  uint16_t *                   len;
+  uint16_t                     xa;
+
+  if (ili9341_font_glyph(c->font, cp) < 0) {
+    cp = ' ';
+  }
+  xa = ili9341_console_advance(c, cp);
+  if (c->col >= c->cols || (c->col > 0 && c->pen + xa > c->width)) {
+    ili9341_console_newline(c);
+  }
+  a    = ili9341_console_screen_row(c, c->row);
+  cell = ili9341_console_row(c, a);
+  len  = &c->len[a % c->backlog];
+  for (; *len < c->col; (*len)++) {
+    cell[*len] = (struct ili9341_console_cell) { ' ', ILI9341_CONSOLE_FG, ILI9341_CONSOLE_BG };
+  }
+  cell[c->col].cp = cp;
+  cell[c->col].fg = c->inverse ? c->bg : c->fg;
+  cell[c->col].bg = c->inverse ? c->fg : c->bg;
+  if (c->bold && cell[c->col].fg < 8) {
+    cell[c->col].fg += 8;
+  }
+  if (c->col == *len) {
+    (*len)++;
+  }
+  c->col++;
+  c->pen += xa;
+  ili9341_console_mark(c, a);
+}
+
+// Cells [from, to) of screen row r become blank.
+static void ili9341_console_erase(struct mgos_ili9341_console *c, uint16_t r, uint16_t from, uint16_t to) {
+  uint32_t                     a    = ili9341_console_screen_row(c, r);
+  struct ili9341_console_cell *cell = ili9341_console_row(c, a);
+  uint16_t *                   len  = &c->len[a % c->backlog];
+
+  if (to >= *len) {
+    if (from < *len) {
+      *len = from;
+    }
+  } else {
+    for (uint16_t i = from; i < to; i++) {
+      cell[i] = (struct ili9341_console_cell) { ' ', ILI9341_CONSOLE_FG, ILI9341_CONSOLE_BG };
+    }
+  }
+  ili9341_console_mark(c, a);
+}
+
+static void ili9341_console_sgr(struct mgos_ili9341_console *c) {
+  if (c->nparams == 0) {
+    c->params[c->nparams++] = 0;
+  }
+  for (uint8_t i = 0; i < c->nparams; i++) {
+    uint16_t p = c->params[i];
+    if (p == 0) {
+      c->fg      = ILI9341_CONSOLE_FG;
+      c->bg      = ILI9341_CONSOLE_BG;
+      c->bold    = false;
+      c->inverse = false;
+    } else if (p == 1) {
+      c->bold = true;
+    } else if (p == 22) {
+      c->bold = false;
+    } else if (p == 7) {
+      c->inverse = true;
+    } else if (p == 27) {
+      c->inverse = false;
+    } else if (p >= 30 && p <= 37) {
+      c->fg = p - 30;
+    } else if (p == 39) {
+      c->fg = ILI9341_CONSOLE_FG;
+    } else if (p >= 40 && p <= 47) {
+      c->bg = p - 40;
+    } else if (p == 49) {
+      c->bg = ILI9341_CONSOLE_BG;
+    } else if (p >= 90 && p <= 97) {
+      c->fg = p - 90 + 8;
+    } else if (p >= 100 && p <= 107) {
+      c->bg = p - 100 + 8;
+    }
+  }
+}
+
+// Executes the control sequence ending in 'final'. Rows and columns are
+// counted from 1, columns in cells.
+static void ili9341_console_csi(struct mgos_ili9341_console *c, char final) {
+  uint16_t n = (c->nparams > 0 && c->params[0] > 0) ? c->params[0] : 1;
+  uint16_t p = c->nparams > 0 ? c->params[0] : 0;
+
+  switch (final) {
+  case 'A':
+    c->row = c->row > n ? c->row - n : 0;
+    break;
+  case 'B':
+    c->row = c->row + n < c->rows ? c->row + n : c->rows - 1;
+    break;
+  case 'C':
+    c->col = c->col + n < c->cols ? c->col + n : c->cols - 1;
+    break;
+  case 'D':
+    c->col = c->col > n ? c->col - n : 0;
+    break;
+  case 'H':
+  case 'f':
+    c->row = n <= c->rows ? n - 1 : c->rows - 1;
+    n      = (c->nparams > 1 && c->params[1] > 0) ? c->params[1] : 1;
+    c->col = n <= c->cols ? n - 1 : c->cols - 1;
+    break;
+  case 'J':
+    if (p == 0) {
+      ili9341_console_erase(c, c->row, c->col, c->cols);
+      for (uint16_t r = c->row + 1; r < c->rows; r++) {
+        ili9341_console_erase(c, r, 0, c->cols);
+      }
+    } else if (p == 1) {
+      for (uint16_t r = 0; r < c->row; r++) {
+        ili9341_console_erase(c, r, 0, c->cols);
+      }
+      ili9341_console_erase(c, c->row, 0, c->col + 1);
+    } else {
+      for (uint16_t r = 0; r < c->rows; r++) {
+        ili9341_console_erase(c, r, 0, c->cols);
+      }
+    }
+    break;
+  case 'K':
+    if (p == 0) {
+      ili9341_console_erase(c, c->row, c->col, c->cols);
+    } else if (p == 1) {
+      ili9341_console_erase(c, c->row, 0, c->col + 1);
+    } else {
+      ili9341_console_erase(c, c->row, 0, c->cols);
+    }
+    break;
+  case 'm':
+    ili9341_console_sgr(c);
+    break;
+  default:
+    break;
+  }
+  ili9341_console_repen(c);
+}
+
+static void ili9341_console_char(struct mgos_ili9341_console *c, uint32_t cp) {
+  switch (c->state) {
+  case ILI9341_CONSOLE_ESC:
+    c->state = (cp == '[') ? ILI9341_CONSOLE_CSI : ILI9341_CONSOLE_TEXT;
+    c->nparams = 0;
+    c->params[0] = 0;
+    return;
+
+  case ILI9341_CONSOLE_CSI:
+    if (cp >= '0' && cp <= '9') {
+      if (c->nparams == 0) {
+        c->nparams = 1;
+      }
+      if (c->nparams <= ILI9341_CONSOLE_PARAMS_MAX) {
+        uint16_t *p = &c->params[c->nparams - 1];
+        *p = *p < 1000 ? *p * 10 + (cp - '0') : *p;
+      }
+    } else if (cp == ';') {
+      if (c->nparams == 0) {
+        c->nparams = 1;
+      }
+      if (c->nparams < ILI9341_CONSOLE_PARAMS_MAX) {
+        c->params[c->nparams] = 0;
+      }
+      c->nparams++;
+    } else if (cp >= 0x40 && cp <= 0x7E) {
+      if (c->nparams > ILI9341_CONSOLE_PARAMS_MAX) {
+        c->nparams = ILI9341_CONSOLE_PARAMS_MAX;
+      }
+      ili9341_console_csi(c, cp);
+      c->state = ILI9341_CONSOLE_TEXT;
+    }
+    return;
+
+  default:
+    break;
+  }
+
+  switch (cp) {
+  case 0x1B:
+    c->state = ILI9341_CONSOLE_ESC;
+    break;
+  case '\n':
+    ili9341_console_newline(c);
+    break;
+  case '\r':
+    c->col = 0;
+    c->pen = 0;
+    break;
+  case '\b':
+    if (c->col > 0) {
+      c->col--;
+      ili9341_console_repen(c);
+    }
+    break;
+  case '\t':
+    do {
+      ili9341_console_put(c, ' ');
+    } while (c->col % ILI9341_CONSOLE_TAB && c->col < c->cols);
+    break;
+  default:
+    if (cp >= 0x20 && cp != 0x7F) {
+      ili9341_console_put(c, cp);
+    }
+  }
+}
+
+// Draws screen row r, showing backlog row a, as a single window.
+static void ili9341_console_draw_row(struct mgos_ili9341_console *c, uint16_t r, uint32_t a) {
+  const struct ili9341_console_cell *cell = ili9341_console_row(c, a);
+  uint16_t                           len  = c->len[a % c->backlog];
+  char *                             p    = c->text;
+
+  for (uint16_t i = 0; i < len; i++) {
+    uint32_t cp = cell[i].cp;
+    if (cp < 0x80) {
+      *p++ = cp;
+    } else if (cp < 0x800) {
+      *p++ = 0xC0 | (cp >> 6);
+      *p++ = 0x80 | (cp & 0x3F);
+    } else if (cp < 0x10000) {
+      *p++ = 0xE0 | (cp >> 12);
+      *p++ = 0x80 | ((cp >> 6) & 0x3F);
+      *p++ = 0x80 | (cp & 0x3F);
+    } else {
+      *p++ = 0xF0 | (cp >> 18);
+      *p++ = 0x80 | ((cp >> 12) & 0x3F);
+      *p++ = 0x80 | ((cp >> 6) & 0x3F);
+      *p++ = 0x80 | (cp & 0x3F);
+    }
+    c->row_colors[2 * i]     = htons(cell[i].fg < 16 ? s_console_palette[cell[i].fg] : c->colors[cell[i].fg - ILI9341_CONSOLE_FG]);
+    c->row_colors[2 * i + 1] = htons(cell[i].bg < 16 ? s_console_palette[cell[i].bg] : c->colors[cell[i].bg - ILI9341_CONSOLE_FG]);
+  }
+  *p = 0;
+  if (!ili9341_layout_string(&c->layout, c->font, c->text)) {
+    return;
+  }
+  ili9341_print_span(c->x0, c->y0 + r * c->font->font_height, &c->layout, 0, c->width, c->font->font_height, c->row_colors);
+}
+
+// Whether the console can scroll with the display: it has to span the
+// screen across the scroll axis, which is then y, so the screen has to be
+// in portrait. In landscape the axis runs along the rows of text.
+static bool ili9341_console_hw(const struct mgos_ili9341_console *c) {
+  uint16_t wx0, wy0;
+
+  ili9341_get_window_origin(&wx0, &wy0);
+  if (wx0 + c->x0 != 0 || c->width != mgos_ili9341_get_screenWidth() || !mgos_ili9341_get_scroll_vertical()) {
+    return false;
+  }
+  return ili9341_scroll_claim(c, wy0 + c->y0, wy0 + c->y0 + c->rows * c->font->font_height - 1);
+}
+
+static void ili9341_console_timer_cb(void *arg) {
+  struct mgos_ili9341_console *c = arg;
+
+  c->timer = MGOS_INVALID_TIMER_ID;
+  mgos_ili9341_console_update(c);
+}
+
+struct mgos_ili9341_console *mgos_ili9341_console_create(uint16_t x0, uint16_t y0, uint16_t width, uint16_t height, const GFXfont *font, uint16_t backlog) {
+  struct mgos_ili9341_console *c;
+  uint16_t                     xa = UINT8_MAX, n;
+
+  if (!font || width == 0) {
+    return NULL;
+  }
+  c = ili9341_malloc(sizeof(*c));
+  if (!c) {
+    return NULL;
+  }
+  memset(c, 0, sizeof(*c));
+  c->font = font;
+  if (font->font_height == 0) {
+    c->font_copy = *font;
+    ili9341_analyzeFont(&c->font_copy);
+    c->font = &c->font_copy;
+  }
+  // Rows hold as many cells as there is room for with the narrowest glyph
+  n = font->codepoints ? font->nglyphs : font->last - font->first + 1;
+  for (uint16_t i = 0; i < n; i++) {
+    if (font->glyph[i].xAdvance > 0 && font->glyph[i].xAdvance < xa) {
+      xa = font->glyph[i].xAdvance;
+    }
+  }
+  c->x0      = x0;
+  c->y0      = y0;
+  c->width   = width;
+  c->height  = height;
+  c->rows    = c->font->font_height > 0 ? height / c->font->font_height : 0;
+  c->cols    = width / xa + 1;
+  c->backlog = backlog > c->rows ? backlog : c->rows;
+  if (c->rows == 0) {
+    mgos_ili9341_console_destroy(c);
+    return NULL;
+  }
+  c->cells      = ili9341_malloc((size_t)c->backlog * c->cols * sizeof(*c->cells));
+  c->len        = ili9341_malloc(c->backlog * sizeof(*c->len));
+  c->dirty      = ili9341_malloc(c->backlog);
+  c->text       = ili9341_malloc(c->cols * 4 + 1);
+  c->row_colors = ili9341_malloc(c->cols * 2 * sizeof(uint16_t));
+  if (!c->cells || !c->len || !c->dirty || !c->text || !c->row_colors) {
+    LOG(LL_ERROR, ("could not malloc console of %u rows of %u cells", c->backlog, c->cols));
+    mgos_ili9341_console_destroy(c);
+    return NULL;
+  }
+  memset(c->len, 0, c->backlog * sizeof(*c->len));
+  memset(c->dirty, 1, c->backlog);
+  c->end   = c->rows;
+  c->count = c->rows;
+  c->fg    = ILI9341_CONSOLE_FG;
+  c->bg    = ILI9341_CONSOLE_BG;
+  c->timer = MGOS_INVALID_TIMER_ID;
+  ili9341_get_colors(&c->colors[0], &c->colors[1]);
+  c->colors[0] = ntohs(c->colors[0]);
+  c->colors[1] = ntohs(c->colors[1]);
+  return c;
+}
+
+void mgos_ili9341_console_write(struct mgos_ili9341_console *c, const char *data, size_t len) {
+  if (!c || !data) {
+    return;
+  }
+  for (size_t i = 0; i < len; i++) {
+    uint8_t b = data[i];
+
+    // Bytes that do not fit a UTF-8 sequence are taken as Latin-1
+    if (c->utf8_left > 0 && (b & 0xC0) == 0x80) {
+      c->utf8_cp = (c->utf8_cp << 6) | (b & 0x3F);
+      if (--c->utf8_left == 0) {
+        ili9341_console_char(c, c->utf8_cp);
+      }
+      continue;
+    }
+    c->utf8_left = 0;
+    if ((b & 0xE0) == 0xC0) {
+      c->utf8_cp   = b & 0x1F;
+      c->utf8_left = 1;
+    } else if ((b & 0xF0) == 0xE0) {
+      c->utf8_cp   = b & 0x0F;
+      c->utf8_left = 2;
+    } else if ((b & 0xF8) == 0xF0) {
+      c->utf8_cp   = b & 0x07;
+      c->utf8_left = 3;
+    } else {
+      ili9341_console_char(c, b);
+    }
+  }
+  if (c->timer == MGOS_INVALID_TIMER_ID && mgos_sys_config_get_ili9341_console_refresh_ms() > 0) {
+    c->timer = mgos_set_timer(mgos_sys_config_get_ili9341_console_refresh_ms(), 0, ili9341_console_timer_cb, c);
+  }
+}
+
+void mgos_ili9341_console_print(struct mgos_ili9341_console *c, const char *s) {
+  if (s) {
+    mgos_ili9341_console_write(c, s, strlen(s));
+  }
+}
+
+void mgos_ili9341_console_printf(struct mgos_ili9341_console *c, const char *fmt, ...) {
+  char    buf[ILI9341_PRINTF_BUF_SIZE];
+  va_list ap;
+
+  va_start(ap, fmt);
+  if (ili9341_vformat(buf, sizeof(buf), fmt, ap)) {
+    mgos_ili9341_console_print(c, buf);
+  }
+  va_end(ap);
+}
+
+void mgos_ili9341_console_scrollback(struct mgos_ili9341_console *c, uint32_t rows) {
+  if (!c) {
+    return;
+  }
+  c->view = rows < c->count - c->rows ? rows : c->count - c->rows;
+  mgos_ili9341_console_update(c);
+}
+
+// Scrolls the display by the rows shown since the last update, and draws
+// the rows that scrolled in or changed. Without hardware scrolling, every
+// row is redrawn when the console scrolled.
+void mgos_ili9341_console_update(struct mgos_ili9341_console *c) {
+  uint32_t top, first, last;
+  int32_t  delta;
+  uint16_t fg, bg;
+  bool     all;
+
+  if (!c) {
+    return;
+  }
+  if (c->timer != MGOS_INVALID_TIMER_ID) {
+    mgos_clear_timer(c->timer);
+    c->timer = MGOS_INVALID_TIMER_ID;
+  }
+  ili9341_get_colors(&fg, &bg);
+  mgos_ili9341_set_fgcolor565(c->colors[0]);
+  mgos_ili9341_set_bgcolor565(c->colors[1]);
+
+  // The area went away with a change of rotation
+  if (c->drawn && c->hw && !ili9341_scroll_owned(c)) {
+    c->drawn = false;
+  }
+  if (!c->drawn) {
+    c->hw = ili9341_console_hw(c);
+    if (c->height > c->rows * c->font->font_height) {
+      mgos_ili9341_set_fgcolor565(c->colors[1]);
+      ili9341_fill_clipped(c->x0, c->y0 + c->rows * c->font->font_height, c->x0 + c->width - 1, c->y0 + c->height - 1);
+      mgos_ili9341_set_fgcolor565(c->colors[0]);
+    }
+  }
+  top   = c->end - c->rows - c->view;
+  delta = (int32_t)(top - c->drawn_top);
+  all   = !c->drawn || (delta != 0 && !c->hw) || delta >= c->rows || delta <= -c->rows;
+  // Rows [first, last) scrolled in
+  first = last = top;
+  if (!all && delta > 0) {
+    mgos_ili9341_scroll(delta * c->font->font_height);
+    first = top + c->rows - delta;
+    last  = top + c->rows;
+  } else if (!all && delta < 0) {
+    mgos_ili9341_scroll(delta * c->font->font_height);
+    last = top - delta;
+  }
+  for (uint16_t r = 0; r < c->rows; r++) {
+    uint32_t a = top + r;
+    if (all || (a >= first && a < last) || c->dirty[a % c->backlog]) {
+      ili9341_console_draw_row(c, r, a);
+      c->dirty[a % c->backlog] = 0;
+    }
+  }
+  c->drawn_top = top;
+  c->drawn     = true;
+
+  mgos_ili9341_set_fgcolor565(ntohs(fg));
+  mgos_ili9341_set_bgcolor565(ntohs(bg));
+}
+
+void mgos_ili9341_console_invalidate(struct mgos_ili9341_console *c) {
+  if (c) {
+    c->drawn = false;
+  }
+}
+
+void mgos_ili9341_console_destroy(struct mgos_ili9341_console *c) {
+  if (!c) {
+    return;
+  }
+  if (c->timer != MGOS_INVALID_TIMER_ID) {
+    mgos_clear_timer(c->timer);
+  }
+  ili9341_scroll_release(c);
+  if (c->font == &c->font_copy) {
+    ili9341_font_forget(c->font);
+  }
+  ili9341_layout_free(&c->layout);
+  free(c->cells);
+  free(c->len);
+  free(c->dirty);
+  free(c->text);
+  free(c->row_colors);
+  free(c);
+}
@@ -16,11 +16,51 @@
 
 #include "mgos_ili9341.h"
 
-static GFXfont *      s_font      = NULL;
-static enum GFXfont_t s_font_type = GFXFONT_NONE;
+#include "mgos_config.h"
+#include "mgos_ili9341_font.h"
+#include "mgos_ili9341_hal.h"
 
-static bool ili9341_analyzeFont(GFXfont *f) {
-  int chars = f->last - f->first;
+// Glyph bitmap expanded into rows of RGB565 pixels, in network byte order.
+struct ili9341_glyph_entry {
+  struct ili9341_glyph_entry *next;  // Next entry in the same bucket
+  const GFXfont *             font;
+  uint16_t                    glyph; // Index of the glyph in the font
+  uint16_t                    fg;
+  uint16_t                    bg;
+  uint8_t                     w;
+  uint8_t                     h;
+  uint32_t                    tick;  // Last use, for LRU eviction
+  uint16_t                    pixels[];
+};
+
+#define ILI9341_GLYPH_BUCKETS    16
+struct ili9341_glyph_cache {
+  struct ili9341_glyph_entry *bucket[ILI9341_GLYPH_BUCKETS];
+  uint32_t                    used; // Bytes held by entries
+  uint32_t                    tick;
+  uint32_t                    print_tick; // Tick at the start of the current print
+};
+
+// Colors of the coverage levels of anti-aliased glyphs, blended between
+// background (level 0) and foreground, in network byte order.
+struct ili9341_blend {
+  uint16_t fg;
+  uint16_t bg;
+  uint8_t  bpp;
+  bool     valid;
+  uint16_t color[16];
+};
+
+static const GFXfont *            s_font      = NULL;
+static enum GFXfont_t             s_font_type = GFXFONT_NONE;
+static struct ili9341_glyph_cache s_glyph_cache;
+static struct ili9341_layout      s_layout;
+static struct ili9341_blend       s_blend;
+static GFXfont                    s_font_copy; // Analyzed copy of a font without metrics
+static const GFXfont *            s_font_copy_src = NULL;
+
+bool ili9341_analyzeFont(GFXfont *f) {
+  int chars = f->codepoints ? f->nglyphs : f->last - f->first + 1;
   int maxHeight = 0, minyo = 0, maxWidth = 0, maxAdvance = 0, minxo = 0, maxxo = 0, maxhyo = 0, minhyo = 0, maxyo = 0, maxwxo = 0, minwxo = 0;
 
   if (f->font_height > 0) return true;  /* Already analyzed */
@@ -82,112 +122,429 @@ static bool ili9341_analyzeFont(GFXfont *f) {
   return true;
 }
 
-uint16_t ili9341_print_fillPixelLine(const char *string, uint8_t line, uint16_t *buf, uint16_t color) {
-  uint16_t pixelline_width = 0;
-  uint8_t *bitmap;
-  uint16_t xx = 0;
-
-  if (!s_font || !string || !buf) {
-    return 0;
-  }
-  bitmap = s_font->bitmap;
-
-//  LOG(LL_DEBUG, ("Line %d of string '%s'", line, string));
-  for (uint16_t i = 0; i < strlen(string); i++) {
-    char c = string[i];
-    if (c < s_font->first || c > s_font->last) {
-      LOG(LL_DEBUG, ("String character 0x%02x is not in font, replacing with ' '", i));
-      c = ' ';
-    }
-    GFXglyph *glyph        = s_font->glyph + (c - s_font->first);
-    uint8_t   w            = glyph->width;
-    uint8_t   h            = glyph->height;
-    int8_t    xo           = glyph->xOffset;
-    int8_t    yo           = glyph->yOffset;
-    int8_t    xa           = glyph->xAdvance;
-    uint16_t  bo           = glyph->bitmapOffset;
-    uint16_t  bo_bitoffset = glyph->width * (line - (yo - s_font->font_min_yOffset));
-    uint8_t   bits;
-    uint16_t  fl = 0, ll = 0;
-
-//    LOG(LL_DEBUG, ("char=0x%02x '%c' w=%d h=%d xOffset=%d yOffset=%d xAdvance=%d bo=%d bo_bitoffset=%d", c, string[i], w, h, xo, yo, xa, bo, bo_bitoffset));
-    if (xo < 0 && pixelline_width == 0) {
+// Returns the blend table of the color pair for bpp bits of coverage, which
+// is only recomputed when the colors change.
+static const uint16_t *ili9341_blend_table(uint16_t fg, uint16_t bg, uint8_t bpp) {
+  uint16_t f, b;
+  int      max = (1 << bpp) - 1;
+
+  if (s_blend.valid && s_blend.fg == fg && s_blend.bg == bg && s_blend.bpp == bpp) {
+    return s_blend.color;
+  }
+  f = ntohs(fg);
+  b = ntohs(bg);
+  for (int i = 0; i <= max; i++) {
+    int r  = ((b >> 11) * (max - i) + (f >> 11) * i + max / 2) / max;
+    int g  = (((b >> 5) & 0x3F) * (max - i) + ((f >> 5) & 0x3F) * i + max / 2) / max;
+    int bl = ((b & 0x1F) * (max - i) + (f & 0x1F) * i + max / 2) / max;
+    s_blend.color[i] = htons((r << 11) | (g << 5) | bl);
+  }
+  s_blend.fg    = fg;
+  s_blend.bg    = bg;
+  s_blend.bpp   = bpp;
+  s_blend.valid = true;
+  return s_blend.color;
+}
+
+// Returns the coverage of pixel i of a glyph bitmap. Pixels are packed most
+// significant bits first, and never straddle a byte.
+static inline uint8_t ili9341_glyph_pixel(const uint8_t *bitmap, uint32_t i, uint8_t bpp) {
+  uint32_t bit = i * bpp;
+
+  return (bitmap[bit / 8] >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1);
+}
+
+// Returns the bitmap of a glyph, which file fonts page in on demand.
+static const uint8_t *ili9341_glyph_bitmap(const GFXfont *font, uint16_t glyph) {
+  if (font->bitmap) {
+    return font->bitmap + font->glyph[glyph].bitmapOffset;
+  }
+  return ili9341_font_file_bitmap(font, glyph);
+}
+
+// Glyph cache -- function names start with ili9341_glyph_
+static uint32_t ili9341_glyph_entry_size(const struct ili9341_glyph_entry *e) {
+  return sizeof(*e) + (uint32_t)e->w * e->h * sizeof(uint16_t);
+}
+
+static int ili9341_glyph_bucket(const GFXfont *font, uint16_t glyph, uint16_t fg, uint16_t bg) {
+  return ((uintptr_t)font / sizeof(void *) + glyph * 31 + fg + bg * 7) % ILI9341_GLYPH_BUCKETS;
+}
+
+// Evicts the least recently used glyph, unless it is used by the current
+// print, as evicting it would have every line expand the string again.
+static bool ili9341_glyph_evict(void) {
+  struct ili9341_glyph_entry **lru = NULL;
+
+  for (int i = 0; i < ILI9341_GLYPH_BUCKETS; i++) {
+    for (struct ili9341_glyph_entry **e = &s_glyph_cache.bucket[i]; *e; e = &(*e)->next) {
+      if (!lru || (*e)->tick < (*lru)->tick) {
+        lru = e;
+      }
+    }
+  }
+  if (!lru || (*lru)->tick > s_glyph_cache.print_tick) {
+    return false;
+  }
+  struct ili9341_glyph_entry *victim = *lru;
+  *lru                = victim->next;
+  s_glyph_cache.used -= ili9341_glyph_entry_size(victim);
+  free(victim);
+  return true;
+}
+
+// Drops the glyphs of one font.
+static void ili9341_glyph_drop(const GFXfont *font) {
+  for (int i = 0; i < ILI9341_GLYPH_BUCKETS; i++) {
+    struct ili9341_glyph_entry **e = &s_glyph_cache.bucket[i];
+
+    while (*e) {
+      struct ili9341_glyph_entry *victim = *e;
+
+      if (victim->font != font) {
+        e = &victim->next;
+        continue;
+      }
+      *e                  = victim->next;
+      s_glyph_cache.used -= ili9341_glyph_entry_size(victim);
+      free(victim);
+    }
+  }
+}
+
+// Returns the expanded glyph, expanding it into the cache if needed, which is
+// reported in *expanded. Returns NULL if the glyph does not fit in the cache,
+// or there is no memory.
+static struct ili9341_glyph_entry *ili9341_glyph_get(const GFXfont *font, uint16_t glyph, uint16_t fg, uint16_t bg, bool *expanded) {
+  int                         bucket = ili9341_glyph_bucket(font, glyph, fg, bg);
+  const GFXglyph *            g      = font->glyph + glyph;
+  const uint8_t *             bitmap;
+  struct ili9341_glyph_entry *e;
+  uint32_t                    size, budget;
+  uint8_t                     bits = 0;
+
+  for (e = s_glyph_cache.bucket[bucket]; e; e = e->next) {
+    if (e->font == font && e->glyph == glyph && e->fg == fg && e->bg == bg) {
+      e->tick   = ++s_glyph_cache.tick;
+      *expanded = false;
+      return e;
+    }
+  }
+
+  // Only now, as file fonts may have to read the bitmap
+  if (!(bitmap = ili9341_glyph_bitmap(font, glyph))) {
+    return NULL;
+  }
+  budget = mgos_sys_config_get_ili9341_glyph_cache_size();
+  size   = sizeof(*e) + (uint32_t)g->width * g->height * sizeof(uint16_t);
+  if (size > budget) {
+    return NULL;
+  }
+  while (s_glyph_cache.used + size > budget) {
+    if (!ili9341_glyph_evict()) {
+      return NULL;
+    }
+  }
+  e = ili9341_malloc(size);
+  if (!e) {
+    return NULL;
+  }
+  e->font  = font;
+  e->glyph = glyph;
+  e->fg    = fg;
+  e->bg    = bg;
+  e->w     = g->width;
+  e->h     = g->height;
+  e->tick  = ++s_glyph_cache.tick;
+  if (font->bpp > 1) {
+    const uint16_t *blend = ili9341_blend_table(fg, bg, font->bpp);
+    for (uint32_t i = 0; i < (uint32_t)e->w * e->h; i++) {
+      e->pixels[i] = blend[ili9341_glyph_pixel(bitmap, i, font->bpp)];
+    }
+  }
+  // Glyph bitmaps are packed, rows do not start on a byte boundary
+  for (uint32_t i = 0; font->bpp <= 1 && i < (uint32_t)e->w * e->h; i++) {
+    if (!(i % 8)) {
+      bits = *bitmap++;
+    }
+    e->pixels[i] = (bits & 0x80) ? fg : bg;
+    bits       <<= 1;
+  }
+  e->next                      = s_glyph_cache.bucket[bucket];
+  s_glyph_cache.bucket[bucket] = e;
+  s_glyph_cache.used          += size;
+  *expanded                     = true;
+  return e;
+}
+
+// Layout -- resolves a string into glyph positions once, rasterization and
+// measurement then work from the layout.
+static bool ili9341_layout_reserve(struct ili9341_layout *layout, size_t len) {
+  if (len + 1 > layout->text_size) {
+    char *text = ili9341_malloc(len + 1);
+    if (!text) {
+      return false;
+    }
+    free(layout->text);
+    layout->text      = text;
+    layout->text_size = len + 1;
+  }
+  if (len > layout->glyphs_size) {
+    struct ili9341_layout_glyph *glyphs = ili9341_malloc(len * sizeof(*glyphs));
+    if (!glyphs) {
+      return false;
+    }
+    free(layout->glyphs);
+    layout->glyphs      = glyphs;
+    layout->glyphs_size = len;
+  }
+  return true;
+}
+
+// Returns the index of the glyph of code point cp, or -1 if the font has
+// none. Sparse fonts are searched by bisection.
+int32_t ili9341_font_glyph(const GFXfont *font, uint32_t cp) {
+  uint16_t lo = 0, hi = font->nglyphs;
+
+  if (!font->codepoints) {
+    return (cp >= font->first && cp <= font->last) ? (int32_t)(cp - font->first) : -1;
+  }
+  while (lo < hi) {
+    uint16_t mid = lo + (hi - lo) / 2;
+    if (font->codepoints[mid] < cp) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return (lo < font->nglyphs && font->codepoints[lo] == cp) ? lo : -1;
+}
+
+// Decodes the UTF-8 sequence at *s and advances *s past it. Bytes that do
+// not start a valid sequence are taken as Latin-1 characters.
+static uint32_t ili9341_utf8_next(const char **s) {
+  const uint8_t *p = (const uint8_t *)*s;
+  uint32_t       cp, min;
+  int            n;
+
+  if (p[0] < 0x80) {
+    *s += 1;
+    return p[0];
+  } else if ((p[0] & 0xE0) == 0xC0) {
+    cp  = p[0] & 0x1F;
+    n   = 1;
+    min = 0x80;
+  } else if ((p[0] & 0xF0) == 0xE0) {
+    cp  = p[0] & 0x0F;
+    n   = 2;
+    min = 0x800;
+  } else if ((p[0] & 0xF8) == 0xF0) {
+    cp  = p[0] & 0x07;
+    n   = 3;
+    min = 0x10000;
+  } else {
+    *s += 1;
+    return p[0];
+  }
+  // The terminating NUL is not a continuation byte, so this stops there
+  for (int i = 1; i <= n; i++) {
+    if ((p[i] & 0xC0) != 0x80) {
+      *s += 1;
+      return p[0];
+    }
+    cp = (cp << 6) | (p[i] & 0x3F);
+  }
+  if (cp < min || cp > 0x10FFFF) {
+    *s += 1;
+    return p[0];
+  }
+  *s += n + 1;
+  return cp;
+}
+
+bool ili9341_layout_string(struct ili9341_layout *layout, const GFXfont *font, const char *string) {
+  size_t   len, n = 0;
+  int16_t  width = 0, ink_end = INT16_MIN;
+  uint16_t max_width = 0, lines = 1;
+
+  if (!layout || !font || !string) {
+    return false;
+  }
+  len          = strlen(string);
+  layout->font = NULL;
+  if (!ili9341_layout_reserve(layout, len)) {
+    LOG(LL_ERROR, ("could not malloc layout for string='%s'", string));
+    return false;
+  }
+  // Strings have at most one glyph per byte
+  for (const char *p = string; *p;) {
+    struct ili9341_layout_glyph *lg = &layout->glyphs[n];
+    uint32_t                     c  = ili9341_utf8_next(&p);
+    int32_t                      index;
+
+    if (c == '\n') {
+      if (width > max_width) {
+        max_width = width;
+      }
+      width   = 0;
+      ink_end = INT16_MIN;
+      lines++;
+      continue;
+    }
+    index = ili9341_font_glyph(font, c);
+    if (index < 0) {
+      LOG(LL_DEBUG, ("String character U+%04X is not in font, replacing with ' '", (unsigned int)c));
+      index = ili9341_font_glyph(font, ' ');
+      if (index < 0) {
+        continue;
+      }
+    }
+    const GFXglyph *glyph = font->glyph + index;
+    uint8_t         w     = glyph->width;
+    int8_t          xo    = glyph->xOffset;
+    int8_t          xa    = glyph->xAdvance;
+
+    if (xo < 0 && width == 0) {
 //      LOG(LL_DEBUG, ("First glyph '%c' has negative xOffset, adding %d to length", c, -xo));
-      pixelline_width = -xo;
+      width = -xo;
+    }
+    lg->glyph    = index;
+    lg->pen      = width;
+    lg->xa       = xa;
+    lg->x        = width + xo;
+    lg->w        = w;
+    lg->h        = glyph->height;
+    lg->fl       = (lines - 1) * font->font_height + glyph->yOffset - font->font_min_yOffset;
+    lg->gap0     = 0;
+    lg->gap1     = 0;
+    if (font->blankRows && font->blankRows[2 * index + 1]) {
+      lg->gap0 = lg->fl + font->blankRows[2 * index];
+      lg->gap1 = lg->gap0 + font->blankRows[2 * index + 1];
+    }
+    lg->overlaps = lg->x < ink_end;
+    if (w > 0 && lg->h > 0 && lg->x + w > ink_end) {
+      ink_end = lg->x + w;
     }
+    width += xa;
+    n++;
+    if ((*p == 0 || *p == '\n') && xo + w > xa) {
+//      LOG(LL_DEBUG, ("Last glyph '%c' is wider than it advances, adding %d to length", c, w-xa+xo));
+      width += (w - xa + xo);
+    }
+  }
+  memcpy(layout->text, string, len + 1);
+  layout->nglyphs = n;
+  layout->width   = width > max_width ? width : max_width;
+  layout->height  = len > 0 ? lines * font->font_height : 0;
+  layout->font    = font;
+  return true;
+}
 
-    // First and last line of char
-    fl = yo - s_font->font_min_yOffset;
-    ll = fl + h - 1;
+void ili9341_layout_free(struct ili9341_layout *layout) {
+  free(layout->text);
+  free(layout->glyphs);
+  memset(layout, 0, sizeof(*layout));
+}
+
+const struct ili9341_layout *ili9341_print_layout(const char *string) {
+  if (!s_font || !string) {
+    return NULL;
+  }
+  if (s_layout.font == s_font && s_layout.text && !strcmp(s_layout.text, string)) {
+    return &s_layout;
+  }
+  return ili9341_layout_string(&s_layout, s_font, string) ? &s_layout : NULL;
+}
+
+// Renders one line of the layout into buf, in fg on bg, or in the colors
+// given for each glyph (fg and bg in turn) if colors is not NULL.
+void ili9341_print_fillPixelLine(const struct ili9341_layout *layout, uint16_t line, uint16_t *buf, uint16_t fg, uint16_t bg, const uint16_t *colors) {
+  if (!layout || !buf) {
+    return;
+  }
+  if (line == 0) {
+    s_glyph_cache.print_tick = s_glyph_cache.tick;
+  }
+
+  for (size_t i = 0; i < layout->nglyphs; i++) {
+    const struct ili9341_layout_glyph *lg = &layout->glyphs[i];
+    struct ili9341_glyph_entry *       e;
+    bool                               expanded;
+
+    if (colors) {
+      fg = colors[2 * i];
+      bg = colors[2 * i + 1];
+    }
+    if (line < lg->fl || line >= lg->fl + lg->h || (line >= lg->gap0 && line < lg->gap1)) {
+      continue;
+    }
+    e = ili9341_glyph_get(layout->font, lg->glyph, fg, bg, &expanded);
+    // Glyphs are counted once, on their first line
+    if (e && line == lg->fl) {
+      if (expanded) {
+        ili9341_stats()->glyph_misses++;
+      } else {
+        ili9341_stats()->glyph_hits++;
+      }
+    }
+    if (e && !lg->overlaps) {
+      memcpy(buf + lg->x, e->pixels + (line - lg->fl) * lg->w, lg->w * sizeof(uint16_t));
+    } else if (e) {
+      // The glyph overlaps its predecessors, only copy its ink
+      const uint16_t *row = e->pixels + (line - lg->fl) * lg->w;
+      for (uint16_t xx = 0; xx < lg->w; xx++) {
+        if (row[xx] != bg) {
+          buf[lg->x + xx] = row[xx];
+        }
+      }
+    } else if (layout->font->bpp > 1) {
+      const uint16_t *blend  = ili9341_blend_table(fg, bg, layout->font->bpp);
+      const uint8_t * bitmap = ili9341_glyph_bitmap(layout->font, lg->glyph);
+      uint32_t        i      = (uint32_t)lg->w * (line - lg->fl);
 
-    if (line < fl || line > ll) {
-//      LOG(LL_DEBUG, ("Glyph '%c' goes from line [%d..%d], skipping", c, fl, ll));
+      if (!bitmap) {
+        continue;
+      }
+      for (uint16_t xx = lg->x; xx < lg->x + lg->w; xx++, i++) {
+        uint8_t v = ili9341_glyph_pixel(bitmap, i, layout->font->bpp);
+        if (v) {
+          buf[xx] = blend[v];
+        }
+      }
     } else {
-      bo           += (bo_bitoffset / 8);
-      bo_bitoffset %= 8;
-//      LOG(LL_DEBUG, ("Glyph '%c' goes from [%d..%d] on lines [%d..%d], data bo=%d%%%d for %d bits", c, pixelline_width+xo, pixelline_width+xo+w-1, fl, ll, bo, bo_bitoffset, w));
+      const uint8_t *bitmap       = ili9341_glyph_bitmap(layout->font, lg->glyph);
+      uint32_t       bo_bitoffset = lg->w * (line - lg->fl);
+      uint32_t       bo           = bo_bitoffset / 8;
+      uint8_t        bits;
 
-      bits   = bitmap[bo];
-      bits <<= bo_bitoffset;
-      for (xx = pixelline_width + xo; xx < pixelline_width + xo + w; xx++) {
+      if (!bitmap) {
+        continue;
+      }
+      bo_bitoffset %= 8;
+      bits          = bitmap[bo] << bo_bitoffset;
+      for (uint16_t xx = lg->x; xx < lg->x + lg->w; xx++) {
         if (bits & 0x80) {
-          buf[xx] = color;
+          buf[xx] = fg;
         }
         bits <<= 1;
-//        LOG(LL_DEBUG, ("bo=%d%%%d (%02x) pixel=%d", bo, bo_bitoffset, bit, xx));
         if (!(++bo_bitoffset % 8)) {
           bits = bitmap[++bo];
         }
       }
     }
-    pixelline_width += xa;
-    if (string[i + 1] == 0 && w > xa + xo) {
-//      LOG(LL_DEBUG, ("Last glyph '%c' is wider than it advances, adding %d to length", string[i], w-xa+xo));
-      pixelline_width += (w - xa + xo);
-    }
   }
-//  LOG(LL_DEBUG, ("pixelline_width returns %d", pixelline_width));
-  return pixelline_width;
 }
 
 uint16_t mgos_ili9341_getStringHeight(const char *string) {
-  if (!s_font || !string || strlen(string) == 0) {
-    return 0;
-  }
-  return s_font->font_height;
+  const struct ili9341_layout *layout = ili9341_print_layout(string);
+
+  return layout ? layout->height : 0;
 }
 
 uint16_t mgos_ili9341_getStringWidth(const char *string) {
-  uint16_t pixelline_width = 0;
+  const struct ili9341_layout *layout = ili9341_print_layout(string);
 
-  if (!s_font || !string) {
-    return 0;
-  }
-
-  for (uint16_t i = 0; i < strlen(string); i++) {
-    char c = string[i];
-    if (c < s_font->first || c > s_font->last) {
-      LOG(LL_WARN, ("String character 0x%02x is not in font, replacing with ' '", i));
-      c = ' ';
-    }
-    GFXglyph *glyph = s_font->glyph + (c - s_font->first);
-    uint8_t   w     = glyph->width;
-    int8_t    xo    = glyph->xOffset;
-    int8_t    xa    = glyph->xAdvance;
-//    LOG(LL_DEBUG, ("char=0x%02x '%c' w=%d xOffset=%d xAdvance=%d", c, c, w, xo, xa));
-
-    if (xo < 0 && pixelline_width == 0) {
-//      LOG(LL_DEBUG, ("First character has negative xOffset, adding %d to length", -xo));
-      pixelline_width = -xo;
-    }
-//    LOG(LL_DEBUG, ("char goes from row [%d..%d], cursor at %d", pixelline_width+xo, pixelline_width+xo+w-1, pixelline_width));
-    pixelline_width += xa;
-    if (string[i + 1] == 0 && w > xa + xo) {
-      LOG(LL_DEBUG, ("Last character is wider than it advances, adding %d to length", w - xa + xo));
-      pixelline_width += (w - xa + xo);
-    }
-  }
-  return pixelline_width;
+  return layout ? layout->width : 0;
 }
 
 int mgos_ili9341_get_max_font_width(void) {
@@ -204,9 +561,28 @@ uint16_t mgos_ili9341_line(int n) {
   return res;
 }
 
-bool mgos_ili9341_set_font(GFXfont *f) {
-  if (s_font_type == GFXFONT_FILE && s_font) {
-    free(s_font);
+// Drops everything cached about a font that is about to be freed, as the
+// glyph cache and layout are keyed by font address, which may be reused.
+void ili9341_font_forget(const GFXfont *font) {
+  ili9341_glyph_drop(font);
+  if (s_layout.font == font) {
+    s_layout.font = NULL;
+  }
+  if (s_font == font) {
+    s_font      = NULL;
+    s_font_type = GFXFONT_NONE;
+  }
+}
+
+bool mgos_ili9341_set_font(const GFXfont *f) {
+  // The file font that is already selected stays owned by the driver
+  if (s_font_type == GFXFONT_FILE && f && s_font == f) {
+    return true;
+  }
+  if (s_font_type == GFXFONT_FILE && s_font && s_font != f) {
+    GFXfont *old = (GFXfont *)s_font;
+    s_font_type = GFXFONT_NONE;
+    mgos_ili9341_font_free(old);
   }
 
   if (!f) {
@@ -214,10 +590,30 @@ bool mgos_ili9341_set_font(GFXfont *f) {
     s_font      = f;
     return false;
   }
-  if (f->font_width == 0 && f->font_height == 0) {
-    ili9341_analyzeFont(f);
+  // Fonts stay untouched, possibly in flash; those without precomputed
+  // metrics are analyzed into a copy.
+  if (f->font_height == 0) {
+    if (s_font_copy_src != f) {
+      LOG(LL_INFO, ("Font has no precomputed metrics, convert it with contrib/fontconvert to select it faster"));
+      ili9341_font_forget(&s_font_copy);
+      s_font_copy = *f;
+      ili9341_analyzeFont(&s_font_copy);
+      s_font_copy_src = f;
+    }
+    f = &s_font_copy;
   }
   s_font      = f;
   s_font_type = GFXFONT_INTERNAL;
   return true;
 }
+
+bool mgos_ili9341_set_font_file(const char *fn) {
+  GFXfont *f = mgos_ili9341_font_load(fn);
+
+  if (!f) {
+    return false;
+  }
+  mgos_ili9341_set_font(f);
+  s_font_type = GFXFONT_FILE;
+  return true;
+}
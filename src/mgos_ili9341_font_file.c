@@ -0,0 +1,220 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mgos_ili9341.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "mgos_config.h"
+#include "mgos_ili9341_font.h"
+#include "mgos_ili9341_hal.h"
+
+#define ILI9341_FONT_FILE_HDR_SIZE             16
+#define ILI9341_FONT_FILE_GLYPH_SIZE           7  // Version 1: dense fonts
+#define ILI9341_FONT_FILE_SPARSE_GLYPH_SIZE    13 // Version 2: sparse fonts
+#define ILI9341_FONT_FILE_NO_GLYPH             0xFFFF
+#define ILI9341_FONT_FILE_MAX_GLYPHS           0xFFFE // Glyph indices stay below NO_GLYPH
+#define ILI9341_FONT_FILE_READ_GLYPHS          32 // Glyph records per read
+
+// A font loaded from a file. The header and glyph table are read when the
+// font is loaded, glyph bitmaps are read into a direct mapped cache of slots
+// when they are needed.
+struct ili9341_font_file {
+  GFXfont   font;       // Must be first, the GFXfont is handed out
+  int       fd;
+  uint32_t  bitmap_pos; // File offset of the glyph bitmaps
+  uint32_t *offsets;    // Bitmap offset of each glyph, which may exceed 64KB
+  uint16_t  slot_size;  // Bytes per slot, fits the largest glyph bitmap
+  uint16_t  nslots;
+  uint16_t *slot_glyph; // Glyph held by each slot
+  uint8_t * slots;
+  GFXglyph  glyphs[];
+};
+
+static uint16_t ili9341_font_file_glyph_size(const GFXfont *font, const GFXglyph *g) {
+  uint8_t bpp = font->bpp > 1 ? font->bpp : 1;
+
+  return ((uint32_t)g->width * g->height * bpp + 7) / 8;
+}
+
+static uint32_t ili9341_font_file_u32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+const uint8_t *ili9341_font_file_bitmap(const GFXfont *font, uint16_t glyph) {
+  struct ili9341_font_file *ff   = (struct ili9341_font_file *)font;
+  const GFXglyph *          g    = &ff->glyphs[glyph];
+  uint16_t                  slot = glyph % ff->nslots;
+  uint8_t *                 buf  = ff->slots + slot * ff->slot_size;
+  uint16_t                  len  = ili9341_font_file_glyph_size(font, g);
+
+  if (ff->slot_glyph[slot] == glyph) {
+    return buf;
+  }
+  ff->slot_glyph[slot] = ILI9341_FONT_FILE_NO_GLYPH;
+  if (len > 0) {
+    if (lseek(ff->fd, ff->bitmap_pos + ff->offsets[glyph], SEEK_SET) < 0 || read(ff->fd, buf, len) != len) {
+      LOG(LL_ERROR, ("Could not read bitmap of glyph %u", glyph));
+      return NULL;
+    }
+  }
+  ff->slot_glyph[slot] = glyph;
+  return buf;
+}
+
+// Reads the glyph table, ILI9341_FONT_FILE_READ_GLYPHS records at a time.
+static bool ili9341_font_file_read_glyphs(struct ili9341_font_file *ff, int fd, bool sparse, uint16_t n) {
+  uint8_t  buf[ILI9341_FONT_FILE_READ_GLYPHS * ILI9341_FONT_FILE_SPARSE_GLYPH_SIZE];
+  uint16_t rec_size = sparse ? ILI9341_FONT_FILE_SPARSE_GLYPH_SIZE : ILI9341_FONT_FILE_GLYPH_SIZE;
+
+  for (uint16_t i = 0; i < n; i++) {
+    const uint8_t *p = buf + (i % ILI9341_FONT_FILE_READ_GLYPHS) * rec_size;
+    GFXglyph *     g = &ff->glyphs[i];
+
+    if (!(i % ILI9341_FONT_FILE_READ_GLYPHS)) {
+      uint16_t count = n - i < ILI9341_FONT_FILE_READ_GLYPHS ? n - i : ILI9341_FONT_FILE_READ_GLYPHS;
+      if (read(fd, buf, count * rec_size) != count * rec_size) {
+        return false;
+      }
+    }
+    if (sparse) {
+      ff->font.codepoints[i] = ili9341_font_file_u32(p);
+      ff->offsets[i]         = ili9341_font_file_u32(p + 4);
+      p                     += 8;
+      // Glyphs are looked up by bisection
+      if (i > 0 && ff->font.codepoints[i] <= ff->font.codepoints[i - 1]) {
+        return false;
+      }
+    } else {
+      ff->offsets[i] = (p[0] << 8) | p[1];
+      p             += 2;
+    }
+    g->bitmapOffset = 0; // Unused, see offsets
+    g->width        = p[0];
+    g->height       = p[1];
+    g->xAdvance     = p[2];
+    g->xOffset      = (int8_t)p[3];
+    g->yOffset      = (int8_t)p[4];
+  }
+  return true;
+}
+
+static void ili9341_font_file_free(struct ili9341_font_file *ff) {
+  free(ff->font.codepoints);
+  free(ff->offsets);
+  free(ff->slot_glyph);
+  free(ff->slots);
+  free(ff);
+}
+
+GFXfont *mgos_ili9341_font_load(const char *fn) {
+  struct ili9341_font_file *ff = NULL;
+  uint8_t                   hdr[ILI9341_FONT_FILE_HDR_SIZE];
+  uint16_t                  n, slot_size = 1;
+  bool                      sparse;
+  int                       nslots;
+  int                       fd;
+
+  fd = open(fn, O_RDONLY);
+  if (fd < 0) {
+    LOG(LL_ERROR, ("%s: Could not open", fn));
+    return NULL;
+  }
+  if (read(fd, hdr, sizeof(hdr)) != sizeof(hdr) || memcmp(hdr, "FNT", 3) || hdr[3] < 1 || hdr[3] > 2) {
+    LOG(LL_ERROR, ("%s: Not a font file", fn));
+    goto err;
+  }
+  sparse = hdr[3] == 2;
+  n      = sparse ? (hdr[12] << 8) | hdr[13] : hdr[5] - hdr[4] + 1;
+  if (n == 0 || (!sparse && hdr[5] < hdr[4])) {
+    LOG(LL_ERROR, ("%s: Font has no glyphs", fn));
+    goto err;
+  }
+  if (n > ILI9341_FONT_FILE_MAX_GLYPHS) {
+    LOG(LL_ERROR, ("%s: Font has more than %u glyphs", fn, ILI9341_FONT_FILE_MAX_GLYPHS));
+    goto err;
+  }
+  ff = ili9341_malloc(sizeof(*ff) + n * sizeof(GFXglyph));
+  if (!ff) {
+    LOG(LL_ERROR, ("%s: Could not malloc font with %u glyphs", fn, n));
+    goto err;
+  }
+  memset(ff, 0, sizeof(*ff));
+  ff->offsets = ili9341_malloc(n * sizeof(uint32_t));
+  if (sparse) {
+    ff->font.codepoints = ili9341_malloc(n * sizeof(uint32_t));
+    ff->font.nglyphs    = n;
+  }
+  if (!ff->offsets || (sparse && !ff->font.codepoints)) {
+    LOG(LL_ERROR, ("%s: Could not malloc font with %u glyphs", fn, n));
+    goto err;
+  }
+  ff->font.glyph    = ff->glyphs;
+  ff->font.first    = hdr[4];
+  ff->font.last     = hdr[5];
+  ff->font.yAdvance = hdr[6];
+  ff->font.bpp      = hdr[7];
+  if (!ili9341_font_file_read_glyphs(ff, fd, sparse, n)) {
+    LOG(LL_ERROR, ("%s: Could not read glyph table", fn));
+    goto err;
+  }
+  for (uint16_t i = 0; i < n; i++) {
+    if (ili9341_font_file_glyph_size(&ff->font, &ff->glyphs[i]) > slot_size) {
+      slot_size = ili9341_font_file_glyph_size(&ff->font, &ff->glyphs[i]);
+    }
+  }
+
+  nslots = mgos_sys_config_get_ili9341_font_cache_slots();
+  if (nslots < 1) {
+    nslots = 1;
+  }
+  ff->slot_glyph = ili9341_malloc(nslots * sizeof(uint16_t));
+  ff->slots      = ili9341_malloc(nslots * slot_size);
+  if (!ff->slot_glyph || !ff->slots) {
+    LOG(LL_ERROR, ("%s: Could not malloc %d glyph slots of %u bytes", fn, nslots, slot_size));
+    goto err;
+  }
+  for (int i = 0; i < nslots; i++) {
+    ff->slot_glyph[i] = ILI9341_FONT_FILE_NO_GLYPH;
+  }
+  ff->fd         = fd;
+  ff->bitmap_pos = ILI9341_FONT_FILE_HDR_SIZE + n * (sparse ? ILI9341_FONT_FILE_SPARSE_GLYPH_SIZE : ILI9341_FONT_FILE_GLYPH_SIZE);
+  ff->slot_size  = slot_size;
+  ff->nslots     = nslots;
+  ili9341_analyzeFont(&ff->font);
+  LOG(LL_DEBUG, ("%s: %u glyphs, %d slots of %u bytes", fn, n, nslots, slot_size));
+  return &ff->font;
+
+err:
+  if (ff) {
+    ili9341_font_file_free(ff);
+  }
+  close(fd);
+  return NULL;
+}
+
+void mgos_ili9341_font_free(GFXfont *font) {
+  struct ili9341_font_file *ff = (struct ili9341_font_file *)font;
+
+  // Fonts compiled into the firmware have their bitmaps in memory
+  if (!font || font->bitmap) {
+    return;
+  }
+  ili9341_font_forget(font);
+  close(ff->fd);
+  ili9341_font_file_free(ff);
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mgos_ili9341.h"
+
+#include "mgos_ili9341_hal.h"
+
+// A gauge is a ring between r_inner and r_outer, from angle start to end,
+// with an indicator covering the angles [lo, hi): from start up to the value
+// for an arc gauge, or a wedge of 'needle' degrees around the value for a
+// needle gauge. The ring's row extents are cached. An update works out the
+// angles that the indicator left and the ones it entered, and fills only
+// those sectors with ili9341_ring_sector(), whose sectors never overlap or
+// leave gaps. The indicator is erased by filling the track in bg, which
+// only blends in on a solid background. Angles are in tenths of a degree.
+struct mgos_ili9341_gauge {
+  struct ili9341_ring ring;
+  int16_t *           ext_o;
+  int16_t *           ext_i;
+  int32_t             start;
+  int32_t             end;
+  int32_t             needle;
+  int32_t             min;
+  int32_t             max;
+  uint16_t            fg;  // Indicator and track colors, in network byte order
+  uint16_t            bg;
+  int32_t             lo;  // Indicator as drawn
+  int32_t             hi;
+  bool                drawn;
+};
+
+// Fills the sector [a, b) of the ring in the given color.
+static void ili9341_gauge_sector(const struct mgos_ili9341_gauge *g, int32_t a, int32_t b, uint16_t color) {
+  if (a >= b) {
+    return;
+  }
+  mgos_ili9341_set_fgcolor565(ntohs(color));
+  ili9341_ring_sector(&g->ring, a, b);
+}
+
+struct mgos_ili9341_gauge *mgos_ili9341_gauge_create(uint16_t x0, uint16_t y0, uint16_t r_outer, uint16_t r_inner,
+                                                     int16_t start, int16_t end, int32_t min, int32_t max, uint16_t needle) {
+  struct mgos_ili9341_gauge *g;
+
+  if (r_inner >= r_outer || start >= end || end - start > 360 || min >= max) {
+    return NULL;
+  }
+  g = ili9341_malloc(sizeof(*g));
+  if (!g) {
+    return NULL;
+  }
+  memset(g, 0, sizeof(*g));
+  g->ext_o = ili9341_malloc((r_outer + 1) * sizeof(int16_t));
+  if (r_inner > 0) {
+    g->ext_i = ili9341_malloc((r_inner + 1) * sizeof(int16_t));
+  }
+  if (!g->ext_o || (r_inner > 0 && !g->ext_i)) {
+    mgos_ili9341_gauge_destroy(g);
+    return NULL;
+  }
+  ili9341_circle_extents(r_outer, g->ext_o);
+  if (g->ext_i) {
+    ili9341_circle_extents(r_inner, g->ext_i);
+  }
+  g->ring.x0      = x0;
+  g->ring.y0      = y0;
+  g->ring.r_outer = r_outer;
+  g->ring.r_inner = r_inner;
+  g->ring.ext_o   = g->ext_o;
+  g->ring.ext_i   = g->ext_i;
+  g->ring.center  = start * 10;
+  g->start        = start * 10;
+  g->end          = end * 10;
+  g->needle       = needle * 10;
+  g->min          = min;
+  g->max          = max;
+  ili9341_get_colors(&g->fg, &g->bg);
+  return g;
+}
+
+void mgos_ili9341_gauge_set(struct mgos_ili9341_gauge *g, int32_t value) {
+  int32_t  a, lo, hi;
+  uint16_t fg, bg;
+
+  if (!g) {
+    return;
+  }
+  if (value < g->min) {
+    value = g->min;
+  }
+  if (value > g->max) {
+    value = g->max;
+  }
+  a  = g->start + ((int64_t)value - g->min) * (g->end - g->start) / ((int64_t)g->max - g->min);
+  lo = g->start;
+  hi = a;
+  if (g->needle > 0) {
+    lo = a - g->needle / 2 > g->start ? a - g->needle / 2 : g->start;
+    hi = lo + g->needle < g->end ? lo + g->needle : g->end;
+    lo = hi - g->needle > g->start ? hi - g->needle : g->start;
+  }
+  if (g->drawn && lo == g->lo && hi == g->hi) {
+    return;
+  }
+
+  ili9341_get_colors(&fg, &bg);
+  if (!g->drawn) {
+    ili9341_gauge_sector(g, g->start, lo, g->bg);
+    ili9341_gauge_sector(g, lo, hi, g->fg);
+    ili9341_gauge_sector(g, hi, g->end, g->bg);
+  } else {
+    // Angles the indicator left, then the ones it entered
+    ili9341_gauge_sector(g, g->lo, g->hi < lo ? g->hi : lo, g->bg);
+    ili9341_gauge_sector(g, g->lo > hi ? g->lo : hi, g->hi, g->bg);
+    ili9341_gauge_sector(g, lo, hi < g->lo ? hi : g->lo, g->fg);
+    ili9341_gauge_sector(g, lo > g->hi ? lo : g->hi, hi, g->fg);
+  }
+  mgos_ili9341_set_fgcolor565(ntohs(fg));
+  mgos_ili9341_set_bgcolor565(ntohs(bg));
+  g->lo    = lo;
+  g->hi    = hi;
+  g->drawn = true;
+}
+
+void mgos_ili9341_gauge_invalidate(struct mgos_ili9341_gauge *g) {
+  if (g) {
+    g->drawn = false;
+  }
+}
+
+void mgos_ili9341_gauge_destroy(struct mgos_ili9341_gauge *g) {
+  if (!g) {
+    return;
+  }
+  free(g->ext_o);
+  free(g->ext_i);
+  free(g);
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mgos_ili9341.h"
+
+#include "mgos_ili9341_font.h"
+#include "mgos_ili9341_hal.h"
+
+// A text field keeps the layout it last drew. An update lays out the new
+// string, marks the columns of every glyph cell that changed (in either the
+// old or the new layout), and repaints runs of marked columns from the new
+// layout.
+struct mgos_ili9341_textfield {
+  uint16_t              x0;
+  uint16_t              y0;
+  uint16_t              width;
+  const GFXfont *       font;
+  GFXfont               font_copy; // Analyzed copy of a font without metrics
+  struct ili9341_layout layout[2]; // Drawn and next layout
+  int                   cur;       // Index of the drawn layout
+  uint8_t *             dirty;     // One bit per column
+  uint16_t              fg;        // Colors the field was drawn in
+  uint16_t              bg;
+  bool                  drawn;
+};
+
+// Columns covered by a glyph: its advance cell and its box, which may stick
+// out of the cell.
+static void ili9341_textfield_mark(struct mgos_ili9341_textfield *tf, const struct ili9341_layout_glyph *lg) {
+  int32_t a = lg->pen < lg->x ? lg->pen : lg->x;
+  int32_t b = lg->pen + lg->xa > lg->x + lg->w ? lg->pen + lg->xa : lg->x + lg->w;
+
+  if (a < 0) {
+    a = 0;
+  }
+  if (b > tf->width) {
+    b = tf->width;
+  }
+  for (int32_t x = a; x < b; x++) {
+    tf->dirty[x / 8] |= 1 << (x % 8);
+  }
+}
+
+static bool ili9341_textfield_is_dirty(const struct mgos_ili9341_textfield *tf, uint16_t x) {
+  return tf->dirty[x / 8] & (1 << (x % 8));
+}
+
+struct mgos_ili9341_textfield *mgos_ili9341_textfield_create(uint16_t x0, uint16_t y0, uint16_t width, const GFXfont *font) {
+  struct mgos_ili9341_textfield *tf;
+
+  if (!font || width == 0) {
+    return NULL;
+  }
+  tf = ili9341_malloc(sizeof(*tf));
+  if (!tf) {
+    return NULL;
+  }
+  memset(tf, 0, sizeof(*tf));
+  tf->dirty = ili9341_malloc((width + 7) / 8);
+  if (!tf->dirty) {
+    free(tf);
+    return NULL;
+  }
+  tf->x0    = x0;
+  tf->y0    = y0;
+  tf->width = width;
+  tf->font  = font;
+  if (font->font_height == 0) {
+    tf->font_copy = *font;
+    ili9341_analyzeFont(&tf->font_copy);
+    tf->font = &tf->font_copy;
+  }
+  return tf;
+}
+
+void mgos_ili9341_textfield_set(struct mgos_ili9341_textfield *tf, const char *s) {
+  struct ili9341_layout *old, *new;
+  uint16_t               fg, bg, height;
+  size_t                 n;
+
+  if (!tf || !s) {
+    return;
+  }
+  old = &tf->layout[tf->cur];
+  new = &tf->layout[!tf->cur];
+  ili9341_get_colors(&fg, &bg);
+  if (tf->drawn && fg == tf->fg && bg == tf->bg && old->text && !strcmp(old->text, s)) {
+    return;
+  }
+  if (!ili9341_layout_string(new, tf->font, s)) {
+    return;
+  }
+
+  memset(tf->dirty, 0, (tf->width + 7) / 8);
+  if (!tf->drawn || fg != tf->fg || bg != tf->bg) {
+    memset(tf->dirty, 0xFF, (tf->width + 7) / 8);
+  } else {
+    n = old->nglyphs > new->nglyphs ? old->nglyphs : new->nglyphs;
+    for (size_t i = 0; i < n; i++) {
+      if (i < old->nglyphs && i < new->nglyphs && old->glyphs[i].glyph == new->glyphs[i].glyph &&
+          old->glyphs[i].x == new->glyphs[i].x && old->glyphs[i].fl == new->glyphs[i].fl) {
+        continue;
+      }
+      if (i < old->nglyphs) {
+        ili9341_textfield_mark(tf, &old->glyphs[i]);
+      }
+      if (i < new->nglyphs) {
+        ili9341_textfield_mark(tf, &new->glyphs[i]);
+      }
+    }
+  }
+
+  height = tf->font->font_height;
+  if (new->height > height) {
+    height = new->height;
+  }
+  if (tf->drawn && old->height > height) {
+    height = old->height;
+  }
+  for (uint16_t x = 0; x < tf->width;) {
+    uint16_t from;
+    if (!ili9341_textfield_is_dirty(tf, x)) {
+      x++;
+      continue;
+    }
+    from = x;
+    while (x < tf->width && ili9341_textfield_is_dirty(tf, x)) {
+      x++;
+    }
+    ili9341_print_span(tf->x0, tf->y0, new, from, x, height, NULL);
+  }
+
+  tf->cur   = !tf->cur;
+  tf->fg    = fg;
+  tf->bg    = bg;
+  tf->drawn = true;
+}
+
+void mgos_ili9341_textfield_printf(struct mgos_ili9341_textfield *tf, const char *fmt, ...) {
+  char    buf[ILI9341_PRINTF_BUF_SIZE];
+  bool    ok;
+  va_list ap;
+
+  va_start(ap, fmt);
+  ok = ili9341_vformat(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  mgos_ili9341_textfield_set(tf, ok ? buf : NULL);
+}
+
+void mgos_ili9341_textfield_invalidate(struct mgos_ili9341_textfield *tf) {
+  if (tf) {
+    tf->drawn = false;
+  }
+}
+
+void mgos_ili9341_textfield_destroy(struct mgos_ili9341_textfield *tf) {
+  if (!tf) {
+    return;
+  }
+  if (tf->font == &tf->font_copy) {
+    ili9341_font_forget(tf->font);
+  }
+  ili9341_layout_free(&tf->layout[0]);
+  ili9341_layout_free(&tf->layout[1]);
+  free(tf->dirty);
+  free(tf);
+}
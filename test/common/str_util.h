@@ -0,0 +1,27 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __STR_UTIL_H
+#define __STR_UTIL_H
+
+#include <stdarg.h>
+#include <stddef.h>
+
+// Prints into *buf, or into a buffer malloc()ed in its place if the output
+// does not fit in size bytes. Returns the length of the output, or -1.
+int mg_avprintf(char **buf, size_t size, const char *fmt, va_list ap);
+
+#endif // __STR_UTIL_H
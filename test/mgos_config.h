@@ -0,0 +1,37 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MGOS_CONFIG_H
+#define __MGOS_CONFIG_H
+
+#include "mgos.h"
+
+int mgos_sys_config_get_ili9341_cs_index(void);
+int mgos_sys_config_get_ili9341_spi_freq(void);
+int mgos_sys_config_get_ili9341_dc_pin(void);
+int mgos_sys_config_get_ili9341_rst_pin(void);
+int mgos_sys_config_get_ili9341_width(void);
+int mgos_sys_config_get_ili9341_height(void);
+bool mgos_sys_config_get_ili9341_framebuffer(void);
+int mgos_sys_config_get_ili9341_band_height(void);
+int mgos_sys_config_get_ili9341_fill_chunk(void);
+int mgos_sys_config_get_ili9341_tx_buf_size(void);
+int mgos_sys_config_get_ili9341_dif_buf_size(void);
+int mgos_sys_config_get_ili9341_font_cache_slots(void);
+int mgos_sys_config_get_ili9341_glyph_cache_size(void);
+int mgos_sys_config_get_ili9341_console_refresh_ms(void);
+
+#endif // __MGOS_CONFIG_H
@@ -0,0 +1,30 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MGOS_GPIO_H
+#define __MGOS_GPIO_H
+
+#include "mgos.h"
+
+enum mgos_gpio_mode {
+  MGOS_GPIO_MODE_INPUT  = 0,
+  MGOS_GPIO_MODE_OUTPUT = 1,
+};
+
+bool mgos_gpio_set_mode(int pin, enum mgos_gpio_mode mode);
+void mgos_gpio_write(int pin, bool level);
+
+#endif // __MGOS_GPIO_H
@@ -0,0 +1,285 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Some functions mocked from MGOS, so we can run unit tests standalone. The
+ * SPI bus ends in a simulated panel, which keeps the pixels written to it.
+ */
+
+#include "mgos.h"
+#include "mgos_config.h"
+#include "mgos_gpio.h"
+#include "mgos_spi.h"
+#include "common/str_util.h"
+
+#define MOCK_DC_PIN    33
+
+enum cs_log_level mock_log_level = LL_WARN;
+struct mock_config mock_config   = {
+  .framebuffer        = false,
+  .band_height        = 16,
+  .fill_chunk         = 512,
+  .tx_buf_size        = 1024,
+  .dif_buf_size       = 4096,
+  .font_cache_slots   = 8,
+  .glyph_cache_size   = 4096,
+  .console_refresh_ms = 0,
+};
+unsigned long mock_spi_bytes = 0;
+unsigned long mock_spi_txns  = 0;
+int           mock_failures  = 0;
+
+int log_print_prefix(enum cs_log_level l, const char *func, const char *file) {
+  static const char *names[] = { "ERROR", "WARN", "INFO", "DEBUG", "VERB" };
+
+  if (l < LL_ERROR || l > mock_log_level) {
+    return 0;
+  }
+  printf("%-5s %-15s %-40s| ", names[l], file, func);
+  return 1;
+}
+
+mgos_timer_id mgos_set_timer(int msecs, int flags, timer_callback cb, void *cb_arg) {
+  static mgos_timer_id id = 0;
+
+  (void)msecs;
+  (void)flags;
+  (void)cb;
+  (void)cb_arg;
+  return ++id;
+}
+
+void mgos_clear_timer(mgos_timer_id id) {
+  (void)id;
+}
+
+void mgos_msleep(uint32_t msecs) {
+  (void)msecs;
+}
+
+void mgos_usleep(uint32_t usecs) {
+  (void)usecs;
+}
+
+int mg_avprintf(char **buf, size_t size, const char *fmt, va_list ap) {
+  va_list ap_copy;
+  int     len;
+
+  va_copy(ap_copy, ap);
+  len = vsnprintf(*buf, size, fmt, ap_copy);
+  va_end(ap_copy);
+  if (len < 0 || (size_t)len < size) {
+    return len;
+  }
+  if (!(*buf = malloc(len + 1))) {
+    return -1;
+  }
+  va_copy(ap_copy, ap);
+  len = vsnprintf(*buf, len + 1, fmt, ap_copy);
+  va_end(ap_copy);
+  return len;
+}
+
+#define MOCK_CONFIG(name, type, value)                      \
+  type mgos_sys_config_get_ili9341_ ## name(void) {         \
+    return value;                                           \
+  }
+
+MOCK_CONFIG(cs_index, int, 0)
+MOCK_CONFIG(spi_freq, int, 20000000)
+MOCK_CONFIG(dc_pin, int, MOCK_DC_PIN)
+MOCK_CONFIG(rst_pin, int, -1)
+MOCK_CONFIG(width, int, MOCK_PANEL_WIDTH)
+MOCK_CONFIG(height, int, MOCK_PANEL_HEIGHT)
+MOCK_CONFIG(framebuffer, bool, mock_config.framebuffer)
+MOCK_CONFIG(band_height, int, mock_config.band_height)
+MOCK_CONFIG(fill_chunk, int, mock_config.fill_chunk)
+MOCK_CONFIG(tx_buf_size, int, mock_config.tx_buf_size)
+MOCK_CONFIG(dif_buf_size, int, mock_config.dif_buf_size)
+MOCK_CONFIG(font_cache_slots, int, mock_config.font_cache_slots)
+MOCK_CONFIG(glyph_cache_size, int, mock_config.glyph_cache_size)
+MOCK_CONFIG(console_refresh_ms, int, mock_config.console_refresh_ms)
+
+// The panel: GRAM in its native portrait orientation, the memory access
+// control and scroll settings, and the state of the command being received.
+static struct {
+  uint16_t gram[MOCK_PANEL_HEIGHT][MOCK_PANEL_WIDTH];
+  uint8_t  madctl;
+  uint16_t tfa, vsa, bfa, vsp;
+  bool     dc;
+  int      cmd;
+  uint8_t  args[6];
+  int      nargs;
+  uint16_t col0, col1, page0, page1;
+  uint16_t col, page;
+  int      hi;
+} s_panel = {
+  .madctl = 0x00,
+  .vsa    = MOCK_PANEL_HEIGHT,
+  .dc     = true,
+  .cmd    = -1,
+  .hi     = -1,
+};
+
+// Maps a column and page address to the GRAM row and column it writes.
+static void mock_panel_map(int col, int page, int *gx, int *gy) {
+  if (s_panel.madctl & 0x20) { // MV
+    int t = col;
+    col  = page;
+    page = t;
+  }
+  *gx = (s_panel.madctl & 0x40) ? MOCK_PANEL_WIDTH - 1 - col : col;   // MX
+  *gy = (s_panel.madctl & 0x80) ? MOCK_PANEL_HEIGHT - 1 - page : page; // MY
+}
+
+uint16_t mock_panel_pixel(int x, int y) {
+  int gx, gy;
+
+  mock_panel_map(x, y, &gx, &gy);
+  if (gx < 0 || gx >= MOCK_PANEL_WIDTH || gy < 0 || gy >= MOCK_PANEL_HEIGHT) {
+    return 0;
+  }
+  // Rows of the scroll area show the rows vsp - tfa further on
+  if (gy >= s_panel.tfa && gy < s_panel.tfa + s_panel.vsa) {
+    gy = s_panel.tfa + (gy - s_panel.tfa + s_panel.vsp - s_panel.tfa) % s_panel.vsa;
+  }
+  return s_panel.gram[gy][gx];
+}
+
+static void mock_panel_args(void) {
+  const uint8_t *a = s_panel.args;
+
+  switch (s_panel.cmd) {
+  case 0x2A: // CASET
+    if (s_panel.nargs == 4) {
+      s_panel.col0 = a[0] << 8 | a[1];
+      s_panel.col1 = a[2] << 8 | a[3];
+    }
+    break;
+
+  case 0x2B: // PASET
+    if (s_panel.nargs == 4) {
+      s_panel.page0 = a[0] << 8 | a[1];
+      s_panel.page1 = a[2] << 8 | a[3];
+    }
+    break;
+
+  case 0x36: // MADCTL
+    s_panel.madctl = a[0];
+    break;
+
+  case 0x33: // VSCRDEF
+    if (s_panel.nargs == 6) {
+      s_panel.tfa = a[0] << 8 | a[1];
+      s_panel.vsa = a[2] << 8 | a[3];
+      s_panel.bfa = a[4] << 8 | a[5];
+      if (s_panel.tfa + s_panel.vsa + s_panel.bfa != MOCK_PANEL_HEIGHT || s_panel.vsa == 0) {
+        printf("FAIL panel: VSCRDEF %u + %u + %u\n", s_panel.tfa, s_panel.vsa, s_panel.bfa);
+        mock_failures++;
+        s_panel.tfa = s_panel.bfa = 0;
+        s_panel.vsa = MOCK_PANEL_HEIGHT;
+      }
+    }
+    break;
+
+  case 0x37: // VSCRSADD
+    if (s_panel.nargs == 2) {
+      s_panel.vsp = a[0] << 8 | a[1];
+      if (s_panel.vsp < s_panel.tfa || s_panel.vsp >= s_panel.tfa + s_panel.vsa) {
+        printf("FAIL panel: VSCRSADD %u outside of the scroll area\n", s_panel.vsp);
+        mock_failures++;
+        s_panel.vsp = s_panel.tfa;
+      }
+    }
+    break;
+  }
+}
+
+static void mock_panel_byte(uint8_t b) {
+  int gx, gy;
+
+  if (!s_panel.dc) {
+    s_panel.cmd   = b;
+    s_panel.nargs = 0;
+    s_panel.hi    = -1;
+    if (b == 0x2C) { // RAMWR
+      s_panel.col  = s_panel.col0;
+      s_panel.page = s_panel.page0;
+    }
+    return;
+  }
+  if (s_panel.cmd != 0x2C) {
+    if (s_panel.nargs < (int)sizeof(s_panel.args)) {
+      s_panel.args[s_panel.nargs++] = b;
+      mock_panel_args();
+    }
+    return;
+  }
+  if (s_panel.hi < 0) {
+    s_panel.hi = b;
+    return;
+  }
+  mock_panel_map(s_panel.col, s_panel.page, &gx, &gy);
+  if (gx >= 0 && gx < MOCK_PANEL_WIDTH && gy >= 0 && gy < MOCK_PANEL_HEIGHT) {
+    s_panel.gram[gy][gx] = s_panel.hi << 8 | b;
+  }
+  s_panel.hi = -1;
+  if (++s_panel.col > s_panel.col1) {
+    s_panel.col = s_panel.col0;
+    if (++s_panel.page > s_panel.page1) {
+      s_panel.page = s_panel.page0;
+    }
+  }
+}
+
+bool mgos_gpio_set_mode(int pin, enum mgos_gpio_mode mode) {
+  (void)pin;
+  (void)mode;
+  return true;
+}
+
+void mgos_gpio_write(int pin, bool level) {
+  if (pin == MOCK_DC_PIN) {
+    s_panel.dc = level;
+  }
+}
+
+struct mgos_spi {
+  int unused;
+};
+
+struct mgos_spi *mgos_spi_get_global(void) {
+  static struct mgos_spi spi;
+
+  return &spi;
+}
+
+bool mgos_spi_run_txn(struct mgos_spi *spi, bool full_duplex, const struct mgos_spi_txn *txn) {
+  const uint8_t *data = txn->hd.tx_data;
+
+  (void)spi;
+  (void)full_duplex;
+  mock_spi_txns++;
+  mock_spi_bytes += txn->hd.tx_len;
+  for (size_t i = 0; i < txn->hd.tx_len; i++) {
+    mock_panel_byte(data[i]);
+  }
+  return true;
+}
+
+int mock_done(const char *test) {
+  printf("%s: %s (%d failures)\n", test, mock_failures ? "FAIL" : "OK", mock_failures);
+  return mock_failures ? 1 : 0;
+}
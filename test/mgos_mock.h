@@ -0,0 +1,113 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MGOS_MOCK_H
+#define __MGOS_MOCK_H
+
+/* Some functions mocked from MGOS, and a simulated panel behind the SPI bus,
+ * so that the driver can be tested on the host.
+ */
+
+#include "mgos.h"
+
+// Platform, as in common/platform.h
+#define CS_P_UNIX      1
+#define CS_P_ESP32     15
+#define CS_PLATFORM    CS_P_UNIX
+
+// mgos_log
+enum cs_log_level {
+  LL_NONE          = -1,
+  LL_ERROR         = 0,
+  LL_WARN          = 1,
+  LL_INFO          = 2,
+  LL_DEBUG         = 3,
+  LL_VERBOSE_DEBUG = 4,
+
+  _LL_MIN          = -2,
+  _LL_MAX          = 5,
+};
+
+// Messages above this level are dropped, LL_WARN unless changed
+extern enum cs_log_level mock_log_level;
+
+int log_print_prefix(enum cs_log_level l, const char *func, const char *file);
+
+#define LOG(l, x)                                       \
+  do {                                                  \
+    if (log_print_prefix(l, __func__, __FILE__)) {      \
+      printf x;                                         \
+      printf("\r\n");                                   \
+    }                                                   \
+  } while (0)
+
+// mgos_timer
+#define MGOS_TIMER_REPEAT        1
+#define MGOS_INVALID_TIMER_ID    0
+typedef uintptr_t mgos_timer_id;
+typedef void (*timer_callback)(void *param);
+
+mgos_timer_id mgos_set_timer(int msecs, int flags, timer_callback cb, void *cb_arg);
+void mgos_clear_timer(mgos_timer_id id);
+
+// mgos_system
+void mgos_msleep(uint32_t msecs);
+void mgos_usleep(uint32_t usecs);
+
+// Library init, called by mgos at boot
+bool mgos_ili9341_spi_init(void);
+
+// Simulated panel: 240x320 pixels of GRAM, addressed through MADCTL, CASET,
+// PASET and RAMWR, and shown through the VSCRDEF/VSCRSADD scroll settings.
+#define MOCK_PANEL_WIDTH     240
+#define MOCK_PANEL_HEIGHT    320
+
+// Configuration returned by mgos_sys_config_get_ili9341_*()
+struct mock_config {
+  bool framebuffer;
+  int  band_height;
+  int  fill_chunk;
+  int  tx_buf_size;
+  int  dif_buf_size;
+  int  font_cache_slots;
+  int  glyph_cache_size;
+  int  console_refresh_ms;
+};
+extern struct mock_config mock_config;
+
+// Color a viewer sees at (x, y) of the screen in its current orientation
+uint16_t mock_panel_pixel(int x, int y);
+
+// Bytes and transactions sent over the SPI bus so far
+extern unsigned long mock_spi_bytes;
+extern unsigned long mock_spi_txns;
+
+// Test results: prints the message if cond fails, and counts the failure
+extern int mock_failures;
+#define CHECK(cond, x)                                   \
+  do {                                                   \
+    if (!(cond)) {                                       \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);        \
+      printf x;                                          \
+      printf("\n");                                      \
+      mock_failures++;                                   \
+    }                                                    \
+  } while (0)
+
+// Prints the summary line and returns the exit status of a test
+int mock_done(const char *test);
+
+#endif // __MGOS_MOCK_H
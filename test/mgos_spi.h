@@ -0,0 +1,40 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MGOS_SPI_H
+#define __MGOS_SPI_H
+
+#include "mgos.h"
+
+struct mgos_spi;
+
+struct mgos_spi_txn {
+  int cs;
+  int mode;
+  int freq;
+  struct {
+    const void *tx_data;
+    size_t      tx_len;
+    size_t      dummy_len;
+    size_t      rx_len;
+    void *      rx_data;
+  } hd;
+};
+
+struct mgos_spi *mgos_spi_get_global(void);
+bool mgos_spi_run_txn(struct mgos_spi *spi, bool full_duplex, const struct mgos_spi_txn *txn);
+
+#endif // __MGOS_SPI_H
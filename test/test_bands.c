@@ -0,0 +1,90 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Band rendering: a frame drawn by render_bands() looks the same whether it
+ * goes through the strip buffer or an active framebuffer, whatever was on
+ * the screen before, and the window and colors are left as they were.
+ */
+
+#include "mgos.h"
+#include "mgos_ili9341.h"
+#include "fonts/FreeSans9pt7b.h"
+
+#define MAX_SIZE    320
+
+static uint16_t s_shot[MAX_SIZE][MAX_SIZE];
+static int      s_calls;
+
+// Changes the window and colors, which every call must start without.
+static void draw(void *arg) {
+  (void)arg;
+  s_calls++;
+  mgos_ili9341_set_window(10, 10, 200, 150);
+  mgos_ili9341_set_fgcolor565(0xF800);
+  mgos_ili9341_fillCircle(50, 50, 40);
+  mgos_ili9341_set_bgcolor565(0x1234);
+  mgos_ili9341_set_fgcolor565(0xFFE0);
+  mgos_ili9341_print(5, 100, "band");
+}
+
+// Fills the screen with a color the frame must hide, and renders the frame.
+static void render(void) {
+  uint16_t w = mgos_ili9341_get_screenWidth(), h = mgos_ili9341_get_screenHeight();
+
+  mgos_ili9341_set_window(0, 0, w - 1, h - 1);
+  mgos_ili9341_set_fgcolor565(0x07E0);
+  mgos_ili9341_fillScreen();
+  mgos_ili9341_flush();
+  mgos_ili9341_set_window(20, 30, w - 1, h - 1);
+  mgos_ili9341_set_fgcolor565(0x8410);
+  mgos_ili9341_set_bgcolor565(0x001F);
+  s_calls = 0;
+  CHECK(mgos_ili9341_render_bands(draw, NULL), ("render_bands failed"));
+  CHECK(s_calls > 0, ("draw was not called"));
+  // Left as they were: a fill lands in the window, in the foreground color
+  mgos_ili9341_fillRect(0, 0, 1, 1);
+  mgos_ili9341_flush();
+  CHECK(mock_panel_pixel(20, 30) == 0x8410, ("window or colors not restored: 0x%04x", mock_panel_pixel(20, 30)));
+}
+
+int main(void) {
+  uint16_t w, h;
+  int      bad = 0;
+
+  mgos_ili9341_spi_init();
+  mgos_ili9341_set_font(&FreeSans9pt7b);
+  w = mgos_ili9341_get_screenWidth();
+  h = mgos_ili9341_get_screenHeight();
+
+  render();
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      s_shot[y][x] = mock_panel_pixel(x, y);
+    }
+  }
+  CHECK(s_shot[h - 1][w - 1] == 0x001F, ("band not filled with the background: 0x%04x", s_shot[h - 1][w - 1]));
+
+  mgos_ili9341_set_framebuffer(true);
+  render();
+  mgos_ili9341_set_framebuffer(false);
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      bad += s_shot[y][x] != mock_panel_pixel(x, y);
+    }
+  }
+  CHECK(bad == 0, ("framebuffer: %d pixels differ from the bands", bad));
+  return mock_done("test_bands");
+}
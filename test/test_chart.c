@@ -0,0 +1,97 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Strip charts: the columns sent as samples are added, in hardware scrolling
+ * and in sweeping charts, show the same as a full redraw of the chart.
+ */
+
+#include "mgos.h"
+#include "mgos_ili9341.h"
+
+#define MAX_SIZE    320
+
+static uint16_t s_shot[MAX_SIZE][MAX_SIZE];
+
+static void snapshot(uint16_t w, uint16_t h) {
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      s_shot[y][x] = mock_panel_pixel(x, y);
+    }
+  }
+}
+
+static int differences(uint16_t w, uint16_t h) {
+  int bad = 0;
+
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      bad += s_shot[y][x] != mock_panel_pixel(x, y);
+    }
+  }
+  return bad;
+}
+
+// Adds the same n samples to a new chart, with a full redraw at the last
+// one if redraw is set.
+static void add_samples(struct mgos_ili9341_chart *c, int n, bool redraw) {
+  srand(n);
+  for (int i = 0; i < n; i++) {
+    if (redraw && i == n - 1) {
+      mgos_ili9341_chart_invalidate(c);
+    }
+    mgos_ili9341_chart_add(c, rand() % 1000);
+  }
+}
+
+// Adds more samples than fit, one column at a time, and compares that with
+// a chart which is redrawn in full at the last sample.
+static void test_chart(uint16_t x0, uint16_t width, uint16_t height) {
+  struct mgos_ili9341_chart *c;
+  uint16_t                   w = mgos_ili9341_get_screenWidth(), h = mgos_ili9341_get_screenHeight();
+  int                        n = 3 * width + 7;
+
+  mgos_ili9341_set_window(0, 0, w - 1, h - 1);
+  mgos_ili9341_set_fgcolor565(0xFFFF);
+  mgos_ili9341_set_bgcolor565(0x0000);
+  for (int redraw = 0; redraw < 2; redraw++) {
+    c = mgos_ili9341_chart_create(x0, 0, width, height, 0, 1000);
+    CHECK(c, ("chart of %ux%u not created", width, height));
+    if (!c) {
+      return;
+    }
+    mgos_ili9341_chart_set_grid(c, 40, 25, 0x4208);
+    add_samples(c, n, redraw);
+    if (!redraw) {
+      snapshot(w, h);
+    } else {
+      int bad = differences(w, h);
+      CHECK(bad == 0, ("%ux%u chart at %u: %d pixels differ after a redraw", width, height, x0, bad));
+    }
+    mgos_ili9341_chart_destroy(c);
+  }
+}
+
+int main(void) {
+  mgos_ili9341_spi_init();
+  mgos_ili9341_set_rotation(ILI9341_LANDSCAPE);
+  // Spanning the screen height scrolls in hardware
+  test_chart(0, 320, 240);
+  test_chart(100, 150, 240);
+  // Shorter charts sweep
+  test_chart(10, 150, 200);
+  test_chart(0, 320, 100);
+  return mock_done("test_chart");
+}
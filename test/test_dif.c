@@ -0,0 +1,179 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* DIF images compressed by contrib/png2dif, decoded by drawDIF() in every
+ * read buffer size and rendering mode, against the same images stored raw.
+ */
+
+#include "mgos.h"
+#include "mgos_ili9341.h"
+#include "dif_rle.h"
+
+#define MAX_W    300
+#define MAX_H    60
+
+static uint16_t s_image[MAX_W * MAX_H];
+static uint16_t s_data[MAX_W * MAX_H];
+static bool     s_framebuffer;
+static uint8_t  s_rle[MAX_W * MAX_H * 2 + MAX_H * (MAX_W / 128 + 1)];
+
+enum pattern { NOISE, RUNS, BOUNDS, FLAT };
+
+static void make_image(enum pattern p, int w, int h) {
+  for (int y = 0; y < h; y++) {
+    uint16_t *row = s_image + y * w;
+    int       x   = 0;
+
+    while (x < w) {
+      int      n;
+      uint16_t color = rand();
+
+      switch (p) {
+      case NOISE: n = 1;
+        break;
+
+      case RUNS: n = 1 + rand() % (rand() % 2 ? 4 : 300);
+        color %= 3;
+        break;
+
+      case BOUNDS: // Literal and repeat runs around the 128 and 129 limits
+        n = (x == 0) ? 128 + y % 3 : 127 + rand() % 5;
+        for (int i = 0; i < n && x + i < w && (x / 128 + y) % 2; i++) {
+          row[x + i] = x + i;
+        }
+        if ((x / 128 + y) % 2) {
+          x += n;
+          continue;
+        }
+        break;
+
+      default: n = w;
+        color = 0x1234;
+        break;
+      }
+      for (int i = 0; i < n && x < w; i++) {
+        row[x++] = color;
+      }
+    }
+  }
+  for (int i = 0; i < w * h; i++) {
+    s_data[i] = htons(s_image[i]);
+  }
+}
+
+static void write_u32(FILE *f, uint32_t v) {
+  v = htonl(v);
+  fwrite(&v, 4, 1, f);
+}
+
+// Writes the image as png2dif does: version 2 and a pixel format, or a
+// version 1 raw file.
+static void write_dif(const char *fn, int w, int h, int version, bool rle) {
+  FILE *   f = fopen(fn, "wb");
+  uint32_t size;
+
+  fwrite("DIF", 3, 1, f);
+  fputc(version, f);
+  write_u32(f, w);
+  write_u32(f, h);
+  if (version == 2) {
+    fputc(rle ? 1 : 0, f);
+    fputc(0, f);
+    fputc(0, f);
+    fputc(0, f);
+  } else {
+    write_u32(f, 0);
+  }
+  if (rle) {
+    size = dif_rle(s_data, w, h, s_rle);
+    CHECK(size <= sizeof(s_rle), ("RLE of %dx%d overran its buffer: %u bytes", w, h, (unsigned)size));
+    fwrite(s_rle, size, 1, f);
+  } else {
+    fwrite(s_data, w * h * 2, 1, f);
+  }
+  fclose(f);
+}
+
+// Draws the file at (x0, y0) of the window [wx0, wx1] x [wy0, wy1] and
+// checks every pixel of the screen.
+static void check_draw(const char *fn, int w, int h, int x0, int y0, const char *what) {
+  const int wx0 = 5, wy0 = 7, wx1 = 230, wy1 = 300;
+  int       bad = 0;
+
+  mgos_ili9341_set_window(0, 0, 239, 319);
+  mgos_ili9341_set_fgcolor565(0xFFFF);
+  mgos_ili9341_fillScreen();
+  mgos_ili9341_set_window(wx0, wy0, wx1, wy1);
+  mgos_ili9341_drawDIF(x0, y0, (char *)fn);
+  mgos_ili9341_flush();
+  for (int y = 0; y < 320; y++) {
+    for (int x = 0; x < 240; x++) {
+      int      ix = x - wx0 - x0, iy = y - wy0 - y0;
+      uint16_t expect = 0xFFFF;
+
+      if (x <= wx1 && y <= wy1 && ix >= 0 && ix < w && iy >= 0 && iy < h) {
+        expect = s_image[iy * w + ix];
+      }
+      bad += mock_panel_pixel(x, y) != expect;
+    }
+  }
+  CHECK(bad == 0, ("%s %dx%d at %d,%d (dif_buf_size %d, framebuffer %d): %d pixels wrong",
+                   what, w, h, x0, y0, mock_config.dif_buf_size, s_framebuffer, bad));
+}
+
+int main(void) {
+  static const struct {
+    enum pattern p;
+    int          w, h;
+  } images[] = {
+    { NOISE, 37, 20 }, { RUNS, 200, 40 }, { BOUNDS, 300, 12 }, { FLAT, 129, 3 }, { RUNS, 1, 60 }, { BOUNDS, 257, 7 },
+  };
+  static const int pos[][2] = { { 0, 0 }, { 10, 20 }, { 180, 250 }, { 220, 290 } };
+  static const int bufs[]   = { 64, 100, 4096 };
+  char             fn[]     = "/tmp/test_dif_XXXXXX";
+  int              fd;
+
+  srand(5);
+  if ((fd = mkstemp(fn)) < 0) {
+    perror(fn);
+    return 1;
+  }
+  close(fd);
+  mgos_ili9341_spi_init();
+  mgos_ili9341_set_rotation(ILI9341_PORTRAIT);
+  for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+    int w = images[i].w, h = images[i].h;
+
+    make_image(images[i].p, w, h);
+    for (int fb = 0; fb < 2; fb++) {
+      s_framebuffer = fb;
+      mgos_ili9341_set_framebuffer(fb);
+      for (size_t b = 0; b < sizeof(bufs) / sizeof(bufs[0]); b++) {
+        mock_config.dif_buf_size = bufs[b];
+        for (size_t p = 0; p < sizeof(pos) / sizeof(pos[0]); p++) {
+          write_dif(fn, w, h, 2, true);
+          check_draw(fn, w, h, pos[p][0], pos[p][1], "rle");
+          write_dif(fn, w, h, 2, false);
+          check_draw(fn, w, h, pos[p][0], pos[p][1], "raw");
+          write_dif(fn, w, h, 1, false);
+          check_draw(fn, w, h, pos[p][0], pos[p][1], "v1");
+        }
+      }
+    }
+  }
+  unlink(fn);
+  return mock_done("test_dif");
+}
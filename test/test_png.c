@@ -0,0 +1,373 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The streaming inflate of upng_decode_rows(), fed a few bytes at a time:
+ * PNGs built here from stored and fixed Huffman blocks with every window
+ * size, and the dynamic Huffman sample images, against upng_decode().
+ */
+
+#include "mgos.h"
+#include "upng.h"
+
+#define MAX_RAW    (64 * 1024)
+
+static const uint16_t LENGTH_BASE[29] = {
+  3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+  31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t  LENGTH_EXTRA[29] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t DISTANCE_BASE[30] = {
+  1,   2,   3,   4,   5,   7,    9,    13,   17,   25,   33,   49,   65,    97,    129,
+  193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t  DISTANCE_EXTRA[30] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+// Output of the encoder: a deflate bit stream, then the PNG around it.
+static struct {
+  uint8_t  data[MAX_RAW * 2];
+  size_t   len;
+  uint32_t bits;
+  int      nbits;
+} s_out;
+
+static void put_bits(uint32_t value, int n) {
+  s_out.bits  |= value << s_out.nbits;
+  s_out.nbits += n;
+  while (s_out.nbits >= 8) {
+    s_out.data[s_out.len++] = s_out.bits;
+    s_out.bits  >>= 8;
+    s_out.nbits  -= 8;
+  }
+}
+
+static void put_align(void) {
+  if (s_out.nbits > 0) {
+    put_bits(0, 8 - s_out.nbits);
+  }
+}
+
+// Huffman codes are sent most significant bit first.
+static void put_code(uint32_t code, int n) {
+  for (int i = n - 1; i >= 0; i--) {
+    put_bits((code >> i) & 1, 1);
+  }
+}
+
+static void put_fixed_symbol(int sym) {
+  if (sym < 144) {
+    put_code(0x30 + sym, 8);
+  } else if (sym < 256) {
+    put_code(0x190 + sym - 144, 9);
+  } else if (sym < 280) {
+    put_code(sym - 256, 7);
+  } else {
+    put_code(0xC0 + sym - 280, 8);
+  }
+}
+
+static void put_match(int len, int dist) {
+  int l = 28, d = 29;
+
+  while (LENGTH_BASE[l] > len) {
+    l--;
+  }
+  put_fixed_symbol(257 + l);
+  put_bits(len - LENGTH_BASE[l], LENGTH_EXTRA[l]);
+  while (DISTANCE_BASE[d] > dist) {
+    d--;
+  }
+  put_code(d, 5);
+  put_bits(dist - DISTANCE_BASE[d], DISTANCE_EXTRA[d]);
+}
+
+// Deflates raw into s_out in blocks of random sizes, stored ones if stored
+// is set and fixed Huffman ones otherwise, with matches at most window back.
+static void deflate(const uint8_t *raw, size_t len, unsigned window, bool stored) {
+  size_t pos = 0;
+
+  do {
+    size_t block = 1 + rand() % (rand() % 4 ? 3000 : 60);
+    bool   last;
+
+    if (block > len - pos) {
+      block = len - pos;
+    }
+    last = pos + block == len;
+    put_bits(last, 1);
+    if (stored) {
+      put_bits(0, 2);
+      put_align();
+      put_bits(block & 0xFFFF, 16);
+      put_bits(~block & 0xFFFF, 16);
+      memcpy(s_out.data + s_out.len, raw + pos, block);
+      s_out.len += block;
+      pos       += block;
+      continue;
+    }
+    put_bits(1, 2);
+    for (size_t end = pos + block; pos < end;) {
+      int best = 0, dist = 0;
+
+      // Longest match, first tried at the distance of one row above
+      for (unsigned d = 1; d <= window && d <= pos && best < 258; d += (d < 64 ? 1 : 1 + rand() % 97)) {
+        int n = 0;
+        while (n < 258 && pos + n < end && raw[pos + n] == raw[pos + n - d]) {
+          n++;
+        }
+        if (n > best) {
+          best = n;
+          dist = d;
+        }
+      }
+      if (best >= 3) {
+        put_match(best, dist);
+        pos += best;
+      } else {
+        put_fixed_symbol(raw[pos++]);
+      }
+    }
+    put_fixed_symbol(256);
+  } while (pos < len);
+  put_align();
+}
+
+static uint32_t crc32(const uint8_t *p, size_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+
+  for (size_t i = 0; i < len; i++) {
+    crc ^= p[i];
+    for (int k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+  return p + 4;
+}
+
+static uint8_t *put_chunk(uint8_t *p, const char *type, const uint8_t *data, size_t len) {
+  p = put_u32(p, len);
+  memcpy(p, type, 4);
+  if (len > 0) {
+    memcpy(p + 4, data, len);
+  }
+  p = put_u32(p + 4 + len, crc32(p, len + 4));
+  return p;
+}
+
+// Builds a PNG of the scanlines in raw, with its zlib stream cut into IDAT
+// chunks of split bytes and text chunks in between. Returns its length.
+static size_t make_png(uint8_t *png, const uint8_t *raw, size_t len, unsigned w, unsigned h, int depth, int type,
+                       unsigned cinfo, bool stored, size_t split) {
+  static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  uint8_t              ihdr[13], *p = png;
+  uint32_t             a = 1, b = 0;
+  unsigned             cmf = cinfo << 4 | 8;
+
+  s_out.len   = 0;
+  s_out.bits  = 0;
+  s_out.nbits = 0;
+  put_bits(cmf, 8);
+  put_bits(31 - (cmf * 256) % 31, 8);
+  deflate(raw, len, 1U << (cinfo + 8), stored);
+  for (size_t i = 0; i < len; i++) {
+    a = (a + raw[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  s_out.len = put_u32(s_out.data + s_out.len, b << 16 | a) - s_out.data;
+
+  memcpy(p, sig, sizeof(sig));
+  put_u32(ihdr, w);
+  put_u32(ihdr + 4, h);
+  ihdr[8]  = depth;
+  ihdr[9]  = type;
+  ihdr[10] = ihdr[11] = ihdr[12] = 0;
+  p        = put_chunk(p + sizeof(sig), "IHDR", ihdr, sizeof(ihdr));
+  for (size_t i = 0; i < s_out.len; i += split) {
+    p = put_chunk(p, "IDAT", s_out.data + i, s_out.len - i < split ? s_out.len - i : split);
+    if (i == 0) {
+      p = put_chunk(p, "tEXt", (const uint8_t *)"Comment\0test", 12);
+    }
+  }
+  p = put_chunk(p, "IEND", NULL, 0);
+  return p - png;
+}
+
+// Source handing out at most max bytes per read, a random number each time.
+struct source {
+  const uint8_t *data;
+  size_t         len;
+  size_t         pos;
+  unsigned       max;
+};
+
+static int source_read(void *arg, unsigned char *buf, unsigned len) {
+  struct source *s = arg;
+  unsigned       n = 1 + rand() % s->max;
+
+  if (n > len) {
+    n = len;
+  }
+  if (n > s->len - s->pos) {
+    n = s->len - s->pos;
+  }
+  memcpy(buf, s->data + s->pos, n);
+  s->pos += n;
+  return n;
+}
+
+// Receiver of the scanlines, checked against the expected image.
+struct rows {
+  const uint8_t *expect;
+  size_t         linebytes;
+  unsigned       next;
+  unsigned       stop;
+  int            bad;
+};
+
+static int rows_cb(void *arg, unsigned y, const unsigned char *row) {
+  struct rows *r = arg;
+
+  r->bad += y != r->next || memcmp(row, r->expect + y * r->linebytes, r->linebytes) != 0;
+  r->next++;
+  return y + 1 != r->stop;
+}
+
+// Decodes the PNG by streaming it in reads of up to max bytes. Returns the
+// error, and the number of rows delivered and wrong in r.
+static upng_error decode_rows(const uint8_t *png, size_t len, unsigned max, struct rows *r) {
+  struct source src  = { png, len, 0, max };
+  upng_t *      upng = upng_new_from_stream(source_read, &src);
+  upng_error    err;
+
+  upng_decode_rows(upng, rows_cb, r);
+  err = upng_get_error(upng);
+  upng_free(upng);
+  return err;
+}
+
+static void test_built(void) {
+  static const struct {
+    unsigned w, h;
+    int      depth, type, bpp;
+  } images[] = {
+    { 100, 60, 8, 2, 3 }, { 77, 50, 8, 6, 4 }, { 40, 30, 16, 2, 6 }, { 120, 90, 8, 0, 1 }, { 64, 64, 8, 4, 2 }, { 1, 40, 8, 2, 3 },
+  };
+  static uint8_t pixels[MAX_RAW], raw[MAX_RAW], png[MAX_RAW * 2];
+  static const unsigned maxs[] = { 1, 7, 512, 5000 };
+
+  for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+    unsigned w = images[i].w, h = images[i].h, bpp = images[i].bpp;
+    size_t   linebytes = w * bpp;
+
+    // Pixels with repeats near and far, filtered with each filter type
+    for (unsigned y = 0; y < h; y++) {
+      for (size_t x = 0; x < linebytes; x++) {
+        pixels[y * linebytes + x] = (x + y) % 5 ? rand() : (x / 7 + y / 3 * 40) & 0xFF;
+      }
+    }
+    for (unsigned y = 0; y < h; y++) {
+      const uint8_t *cur  = pixels + y * linebytes;
+      const uint8_t *prev = y ? cur - linebytes : NULL;
+      uint8_t *      out  = raw + y * (linebytes + 1);
+      int            f    = y % 5;
+
+      out[0] = f;
+      for (size_t x = 0; x < linebytes; x++) {
+        int a = x >= bpp ? cur[x - bpp] : 0, b = prev ? prev[x] : 0, c = prev && x >= bpp ? prev[x - bpp] : 0;
+        int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+        int pred[5] = { 0, a, b, (a + b) / 2, (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c) };
+        out[1 + x] = cur[x] - pred[f];
+      }
+    }
+    for (unsigned cinfo = 0; cinfo <= 7; cinfo++) {
+      for (int stored = 0; stored < 2; stored++) {
+        size_t split = (cinfo % 3 == 0) ? 1 + rand() % 40 : 8192;
+        size_t len   = make_png(png, raw, h * (linebytes + 1), w, h, images[i].depth, images[i].type, cinfo, stored, split);
+        upng_t *upng = upng_new_from_bytes(png, len);
+
+        upng_decode(upng);
+        CHECK(upng_get_error(upng) == UPNG_EOK && !memcmp(upng_get_buffer(upng), pixels, h * linebytes),
+              ("image %d, window %u, stored %d: upng_decode() error %d", (int)i, 256U << cinfo, stored, upng_get_error(upng)));
+        upng_free(upng);
+
+        for (size_t m = 0; m < sizeof(maxs) / sizeof(maxs[0]); m++) {
+          struct rows r   = { pixels, linebytes, 0, 0, 0 };
+          upng_error  err = decode_rows(png, len, maxs[m], &r);
+
+          CHECK(err == UPNG_EOK && r.next == h && r.bad == 0,
+                ("image %d, window %u, stored %d, reads of %u: error %d, %u rows, %d wrong",
+                 (int)i, 256U << cinfo, stored, maxs[m], err, r.next, r.bad));
+        }
+      }
+    }
+    // Stopping early, and running out of data
+    {
+      size_t      len = make_png(png, raw, h * (linebytes + 1), w, h, images[i].depth, images[i].type, 7, false, 100);
+      struct rows r   = { pixels, linebytes, 0, h / 2 + 1, 0 };
+      upng_error  err = decode_rows(png, len, 64, &r);
+
+      CHECK(err == UPNG_EOK && r.next == h / 2 + 1 && r.bad == 0, ("image %d stopped: error %d, %u rows", (int)i, err, r.next));
+      r   = (struct rows) { pixels, linebytes, 0, 0, 0 };
+      err = decode_rows(png, len / 2, 64, &r);
+      CHECK(err != UPNG_EOK && r.next < h && r.bad == 0, ("image %d truncated: error %d, %u rows", (int)i, err, r.next));
+    }
+  }
+}
+
+// The sample images, made by other encoders with dynamic Huffman blocks.
+static void test_file(const char *fn) {
+  static uint8_t png[64 * 1024];
+  FILE *         f = fopen(fn, "rb");
+  size_t         len;
+  upng_t *       upng;
+
+  CHECK(f != NULL, ("%s not found", fn));
+  if (!f) {
+    return;
+  }
+  len = fread(png, 1, sizeof(png), f);
+  fclose(f);
+  upng = upng_new_from_bytes(png, len);
+  upng_decode(upng);
+  CHECK(upng_get_error(upng) == UPNG_EOK, ("%s: upng_decode() error %d", fn, upng_get_error(upng)));
+  for (unsigned max = 1; max <= 4096; max *= 4) {
+    struct rows r   = { upng_get_buffer(upng), upng_get_width(upng) * upng_get_pixelsize(upng) / 8, 0, 0, 0 };
+    upng_error  err = decode_rows(png, len, max, &r);
+
+    CHECK(err == UPNG_EOK && r.next == upng_get_height(upng) && r.bad == 0,
+          ("%s, reads of %u: error %d, %u rows, %d wrong", fn, max, err, r.next, r.bad));
+  }
+  upng_free(upng);
+}
+
+int main(void) {
+  srand(7);
+  test_built();
+  test_file("../contrib/png2dif/data/flowers.png");
+  test_file("../contrib/png2dif/data/mongoose-os.png");
+  return mock_done("test_png");
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Sectors of rings, as drawn by fillArc() and gauges: adjacent sectors must
+ * neither overlap nor leave gaps, and together make up the whole ring.
+ */
+
+#include "mgos.h"
+#include "mgos_ili9341.h"
+#include "mgos_ili9341_hal.h"
+
+#define MAX_SIZE    320
+
+static uint16_t s_width, s_height;
+static uint8_t  s_count[MAX_SIZE][MAX_SIZE];
+static uint16_t s_shot[MAX_SIZE][MAX_SIZE];
+
+static void clear(void) {
+  mgos_ili9341_set_fgcolor565(0);
+  mgos_ili9341_fillScreen();
+  mgos_ili9341_set_fgcolor565(0xFFFF);
+}
+
+static void count_lit(void) {
+  for (int y = 0; y < s_height; y++) {
+    for (int x = 0; x < s_width; x++) {
+      s_count[y][x] += mock_panel_pixel(x, y) != 0;
+    }
+  }
+}
+
+static void shoot(void) {
+  for (int y = 0; y < s_height; y++) {
+    for (int x = 0; x < s_width; x++) {
+      s_shot[y][x] = mock_panel_pixel(x, y);
+    }
+  }
+}
+
+// Returns the number of pixels that differ from the last shot.
+static int diff_shot(void) {
+  int n = 0;
+
+  for (int y = 0; y < s_height; y++) {
+    for (int x = 0; x < s_width; x++) {
+      n += s_shot[y][x] != mock_panel_pixel(x, y);
+    }
+  }
+  return n;
+}
+
+// Random partitions of rings into sectors cover each pixel of the ring once.
+static void test_partition(void) {
+  int16_t ext_o[MAX_SIZE], ext_i[MAX_SIZE];
+  int     x0 = s_width / 2, y0 = s_height / 2;
+
+  for (int i = 0; i < 60; i++) {
+    int                 r_outer = 5 + rand() % 100;
+    int                 r_inner = (i % 3 == 0) ? 0 : rand() % r_outer;
+    int32_t             a       = (rand() % 360 - 180) * 10;
+    struct ili9341_ring ring    = { x0, y0, r_outer, r_inner, ext_o, r_inner ? ext_i : NULL, a };
+    int                 twice = 0, wrong = 0;
+
+    ili9341_circle_extents(r_outer, ext_o);
+    if (r_inner) {
+      ili9341_circle_extents(r_inner, ext_i);
+    }
+    memset(s_count, 0, sizeof(s_count));
+    for (int32_t s = a, e; s < a + 3600; s = e) {
+      e = s + 1 + rand() % 1200;
+      if (e > a + 3600) {
+        e = a + 3600;
+      }
+      clear();
+      ili9341_ring_sector(&ring, s, e);
+      count_lit();
+    }
+    // The whole ring is the circle less the inner disk
+    clear();
+    mgos_ili9341_fillCircle(x0, y0, r_outer);
+    if (r_inner) {
+      mgos_ili9341_set_fgcolor565(0);
+      mgos_ili9341_fillCircle(x0, y0, r_inner);
+    }
+    for (int y = 0; y < s_height; y++) {
+      for (int x = 0; x < s_width; x++) {
+        twice += s_count[y][x] > 1;
+        wrong += (s_count[y][x] != 0) != (mock_panel_pixel(x, y) != 0);
+      }
+    }
+    CHECK(twice == 0 && wrong == 0, ("ring %d..%d from %d: %d pixels drawn twice, %d wrong", r_inner, r_outer, (int)a, twice, wrong));
+  }
+}
+
+// fillArc() draws the same sectors as gauges, center pixel included.
+static void test_arc(void) {
+  int16_t ext_o[MAX_SIZE], ext_i[MAX_SIZE];
+  int     x0 = s_width / 2, y0 = s_height / 2;
+
+  for (int i = 0; i < 60; i++) {
+    int                 r_outer = 5 + rand() % 100;
+    int                 r_inner = (i % 3 == 0) ? 0 : rand() % r_outer;
+    int                 start   = rand() % 720 - 360;
+    int                 end     = start + 1 + rand() % 360;
+    struct ili9341_ring ring    = { x0, y0, r_outer, r_inner, ext_o, r_inner ? ext_i : NULL, start * 10 };
+    int                 n;
+
+    ili9341_circle_extents(r_outer, ext_o);
+    if (r_inner) {
+      ili9341_circle_extents(r_inner, ext_i);
+    }
+    clear();
+    mgos_ili9341_fillArc(x0, y0, r_outer, r_inner, start, end);
+    shoot();
+    clear();
+    ili9341_ring_sector(&ring, start * 10, end * 10);
+    n = diff_shot();
+    CHECK(n == 0, ("arc %d..%d of ring %d..%d: %d pixels differ from the sector", start, end, r_inner, r_outer, n));
+    if (r_inner == 0) {
+      CHECK(s_shot[y0][x0] != 0, ("arc %d..%d of disk %d: center not drawn", start, end, r_outer));
+    }
+  }
+}
+
+// Gauges updated step by step look the same as when drawn afresh, and their
+// indicator and track make up the ring drawn by fillArc().
+static void test_gauge(void) {
+  static const struct {
+    uint16_t x0, y0, r_outer, r_inner;
+    int16_t  start, end;
+    uint16_t needle;
+  } gauges[] = {
+    { 120, 120, 100, 70, 135,  405, 0  },
+    { 120, 120, 110, 10, -225, 45,  6  },
+    { 60,  60,  50,  0,  0,    360, 0  },
+    { 200, 180, 90,  30, 180,  360, 3  },
+    { 160, 120, 119, 0,  -90,  270, 20 },
+    { 100, 100, 60,  0,  30,   150, 0  },
+    { 10,  10,  40,  20, 90,   180, 0  },
+  };
+
+  for (size_t k = 0; k < sizeof(gauges) / sizeof(gauges[0]); k++) {
+    struct mgos_ili9341_gauge *g;
+    int32_t                    value = 0;
+    int                        n, lit = 0;
+
+    clear();
+    mgos_ili9341_set_fgcolor565(0x07E0);
+    mgos_ili9341_set_bgcolor565(0x0841);
+    g = mgos_ili9341_gauge_create(gauges[k].x0, gauges[k].y0, gauges[k].r_outer, gauges[k].r_inner,
+                                  gauges[k].start, gauges[k].end, 0, 1000, gauges[k].needle);
+    CHECK(g != NULL, ("gauge %d not created", (int)k));
+    if (!g) {
+      continue;
+    }
+    for (int i = 0; i < 300; i++) {
+      value = (i % 50 == 0) ? rand() % 1200 - 100 : value + rand() % 41 - 20;
+      mgos_ili9341_gauge_set(g, value);
+    }
+    shoot();
+    clear();
+    mgos_ili9341_gauge_invalidate(g);
+    mgos_ili9341_gauge_set(g, value);
+    n = diff_shot();
+    CHECK(n == 0, ("gauge %d: %d pixels differ from a fresh draw at %d", (int)k, n, (int)value));
+
+    clear();
+    mgos_ili9341_fillArc(gauges[k].x0, gauges[k].y0, gauges[k].r_outer, gauges[k].r_inner, gauges[k].start, gauges[k].end);
+    for (int y = 0; y < s_height; y++) {
+      for (int x = 0; x < s_width; x++) {
+        bool ring  = mock_panel_pixel(x, y) != 0;
+        bool gauge = s_shot[y][x] == 0x07E0 || s_shot[y][x] == 0x0841;
+        lit += ring != gauge;
+      }
+    }
+    CHECK(lit == 0, ("gauge %d: %d pixels differ from its ring", (int)k, lit));
+    mgos_ili9341_gauge_destroy(g);
+  }
+}
+
+int main(void) {
+  srand(3);
+  mgos_ili9341_spi_init();
+  mgos_ili9341_set_rotation(ILI9341_LANDSCAPE);
+  s_width  = mgos_ili9341_get_screenWidth();
+  s_height = mgos_ili9341_get_screenHeight();
+  test_partition();
+  test_arc();
+  test_gauge();
+  return mock_done("test_sector");
+}
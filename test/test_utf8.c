@@ -0,0 +1,168 @@
+/*
+ * Copyright 2017 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Strings laid out in sparse fonts: UTF-8 decoding, with invalid bytes taken
+ * as Latin-1, and the bisection of the font's code points. Also checks that
+ * printf output is truncated between characters.
+ */
+
+#include "mgos.h"
+#include "mgos_ili9341.h"
+#include "mgos_ili9341_font.h"
+#include "mgos_ili9341_hal.h"
+
+#define MAX_GLYPHS    64
+
+static uint32_t s_codepoints[MAX_GLYPHS] = {
+  0x20, 0x41, 0x42, 0x7F, 0x80, 0x82, 0x90, 0xC3, 0xE9, 0x3B1, 0x7FF, 0x800, 0x20AC, 0xFFFF, 0x10000, 0x1F600, 0x10FFFF,
+};
+static GFXglyph s_glyphs[MAX_GLYPHS];
+static GFXfont  s_font = {
+  .glyph      = s_glyphs,
+  .yAdvance   = 10,
+  .codepoints = s_codepoints,
+  .nglyphs    = 17,
+};
+
+static int32_t find(const GFXfont *font, uint32_t cp) {
+  for (int i = 0; i < font->nglyphs; i++) {
+    if (font->codepoints[i] == cp) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Lays out the string and checks that it resolved to the glyphs of the code
+// points, where those missing from the font are shown as spaces if it has one.
+static void check_string(const GFXfont *font, const char *string, const uint32_t *cps, size_t n) {
+  struct ili9341_layout layout = { 0 };
+  size_t                k      = 0;
+
+  CHECK(ili9341_layout_string(&layout, font, string), ("layout of \"%s\" failed", string));
+  for (size_t i = 0; i < n; i++) {
+    int32_t index = find(font, cps[i]);
+
+    if (index < 0) {
+      index = find(font, ' ');
+    }
+    if (index < 0) {
+      continue;
+    }
+    CHECK(k < layout.nglyphs && layout.glyphs[k].glyph == index,
+          ("\"%s\": glyph %d is %d, expected %d for U+%04X", string, (int)k,
+           k < layout.nglyphs ? layout.glyphs[k].glyph : -1, (int)index, (unsigned)cps[i]));
+    k++;
+  }
+  CHECK(layout.nglyphs == k, ("\"%s\": %d glyphs, expected %d", string, (int)layout.nglyphs, (int)k));
+  ili9341_layout_free(&layout);
+}
+
+#define CHECK_STRING(font, string, ...)                                 \
+  do {                                                                  \
+    static const uint32_t cps[] = { __VA_ARGS__ };                      \
+    check_string(font, string, cps, sizeof(cps) / sizeof(cps[0]));      \
+  } while (0)
+
+static void test_utf8(const GFXfont *font) {
+  CHECK_STRING(font, "AB", 'A', 'B');
+  CHECK_STRING(font, "A\nB", 'A', 'B');
+  CHECK_STRING(font, "AZB", 'A', 'Z', 'B');
+  // Shortest and longest sequences of each length
+  CHECK_STRING(font, "\x7F", 0x7F);
+  CHECK_STRING(font, "\xC2\x80\xDF\xBF", 0x80, 0x7FF);
+  CHECK_STRING(font, "\xC3\xA9\xCE\xB1", 0xE9, 0x3B1);
+  CHECK_STRING(font, "\xE0\xA0\x80\xE2\x82\xAC\xEF\xBF\xBF", 0x800, 0x20AC, 0xFFFF);
+  CHECK_STRING(font, "\xF0\x90\x80\x80\xF0\x9F\x98\x80\xF4\x8F\xBF\xBF", 0x10000, 0x1F600, 0x10FFFF);
+  // Invalid bytes are Latin-1 characters, and do not swallow what follows
+  CHECK_STRING(font, "\xC3" "A", 0xC3, 'A');
+  CHECK_STRING(font, "A\xC3", 'A', 0xC3);
+  CHECK_STRING(font, "\x80\x82", 0x80, 0x82);
+  CHECK_STRING(font, "\xE2\x82", 0xE2, 0x82);
+  CHECK_STRING(font, "\xE2\x82" "B", 0xE2, 0x82, 'B');
+  CHECK_STRING(font, "\xC0\x80", 0xC0, 0x80);
+  CHECK_STRING(font, "\xE0\x80\x80", 0xE0, 0x80, 0x80);
+  CHECK_STRING(font, "\xF0\x80\x80\x80", 0xF0, 0x80, 0x80, 0x80);
+  CHECK_STRING(font, "\xF4\x90\x80\x80", 0xF4, 0x90, 0x80, 0x80);
+  CHECK_STRING(font, "\xF8\x80" "A", 0xF8, 0x80, 'A');
+}
+
+// ili9341_font_glyph() finds exactly the code points of the font.
+static void test_bisect(void) {
+  GFXfont dense = { .first = 0x20, .last = 0x7E };
+  GFXfont font  = { .codepoints = s_codepoints };
+
+  for (uint32_t cp = 0; cp < 0x200; cp++) {
+    int32_t expect = (cp >= 0x20 && cp <= 0x7E) ? (int32_t)cp - 0x20 : -1;
+    CHECK(ili9341_font_glyph(&dense, cp) == expect, ("dense font: U+%04X", (unsigned)cp));
+  }
+  for (int n = 0; n <= MAX_GLYPHS; n++) {
+    uint32_t cp = rand() % 4;
+
+    for (int i = 0; i < n; i++) {
+      s_codepoints[i] = cp;
+      cp += 1 + (rand() % 4 ? rand() % 3 : rand() % 0x8000);
+    }
+    font.nglyphs = n;
+    for (int i = 0; i < n; i++) {
+      for (uint32_t d = 0; d < 3; d++) {
+        uint32_t c = s_codepoints[i] + d - 1;
+        CHECK(ili9341_font_glyph(&font, c) == find(&font, c), ("%d glyphs: U+%04X", n, (unsigned)c));
+      }
+    }
+    CHECK(ili9341_font_glyph(&font, 0x10FFFF) == find(&font, 0x10FFFF), ("%d glyphs: U+10FFFF", n));
+    CHECK(ili9341_font_glyph(&font, UINT32_MAX) == -1, ("%d glyphs: 0x%08X", n, UINT32_MAX));
+  }
+}
+
+static bool format(char *buf, size_t size, const char *fmt, ...) {
+  va_list ap;
+  bool    ok;
+
+  va_start(ap, fmt);
+  ok = ili9341_vformat(buf, size, fmt, ap);
+  va_end(ap);
+  return ok;
+}
+
+// ili9341_vformat() keeps what fits and never ends on part of a sequence.
+static void test_truncate(void) {
+  char buf[6];
+
+  CHECK(format(buf, sizeof(buf), "%s", "AB") && !strcmp(buf, "AB"), ("\"%s\", expected \"AB\"", buf));
+  CHECK(format(buf, sizeof(buf), "%d", 1234567) && !strcmp(buf, "12345"), ("\"%s\", expected \"12345\"", buf));
+  CHECK(format(buf, sizeof(buf), "%s", "AB\xE2\x82\xAC") && !strcmp(buf, "AB\xE2\x82\xAC"), ("\"%s\": the euro sign fits", buf));
+  CHECK(format(buf, sizeof(buf), "%s", "ABC\xE2\x82\xAC") && !strcmp(buf, "ABC"), ("\"%s\", expected \"ABC\"", buf));
+  CHECK(format(buf, sizeof(buf), "%s", "\xC3\xA9\xC3\xA9\xC3\xA9") && !strcmp(buf, "\xC3\xA9\xC3\xA9"), ("\"%s\", expected two characters", buf));
+}
+
+int main(void) {
+  GFXfont no_space = s_font;
+
+  mgos_ili9341_spi_init();
+  for (int i = 0; i < s_font.nglyphs; i++) {
+    s_glyphs[i].xAdvance = 1 + i;
+  }
+  test_utf8(&s_font);
+  // A font without a space drops the characters it lacks
+  no_space.codepoints++;
+  no_space.glyph++;
+  no_space.nglyphs--;
+  test_utf8(&no_space);
+  test_bisect();
+  test_truncate();
+  return mock_done("test_utf8");
+}
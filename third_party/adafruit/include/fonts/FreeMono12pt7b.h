@@ -252,10 +252,28 @@ const GFXglyph FreeMono12pt7bGlyphs[] = {
   { 1456, 10, 3,  14, 2, -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeMono12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMono12pt7bBlankRows[] = {
+  0, 0, 10, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 4, 3, 4, 0, 0, 1, 2, 0, 0, 9, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 2, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMono12pt7b = {
   (uint8_t *)FreeMono12pt7bBitmaps,
   (GFXglyph *)FreeMono12pt7bGlyphs,
-  0x20,                            0x7E,24, 0, 0, 0, 0
+  0x20,                            0x7E,24, 20, 14, 0, -15, 1, NULL, 0,
+  (uint8_t *)FreeMono12pt7bBlankRows
 };
 
 // Approx. 2132 bytes
@@ -388,10 +388,28 @@ const GFXglyph FreeMono18pt7bGlyphs[] = {
   { 3079, 15, 5,  21, 3,  -11 }
 };                                        // 0x7E '~'
 
-GFXfont FreeMono18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMono18pt7bBlankRows[] = {
+  0, 0, 15, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 5, 5, 0, 0, 1, 4, 0, 0, 13, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMono18pt7b = {
   (uint8_t *)FreeMono18pt7bBitmaps,
   (GFXglyph *)FreeMono18pt7bGlyphs,
-  0x20,                            0x7E,35, 0, 0, 0, 0
+  0x20,                            0x7E,35, 30, 21, 0, -22, 1, NULL, 0,
+  (uint8_t *)FreeMono18pt7bBlankRows
 };
 
 // Approx. 3761 bytes
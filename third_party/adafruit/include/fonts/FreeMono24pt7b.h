@@ -602,10 +602,28 @@ const GFXglyph FreeMono24pt7bGlyphs[] = {
   { 5643, 20, 6,  28, 4,  -15 }
 };                                        // 0x7E '~'
 
-GFXfont FreeMono24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMono24pt7bBlankRows[] = {
+  0, 0, 19, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 9, 6, 7, 0, 0, 2, 5, 0, 0, 18, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 4, 5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMono24pt7b = {
   (uint8_t *)FreeMono24pt7bBitmaps,
   (GFXglyph *)FreeMono24pt7bGlyphs,
-  0x20,                            0x7E,47, 0, 0, 0, 0
+  0x20,                            0x7E,47, 40, 28, 0, -30, 1, NULL, 0,
+  (uint8_t *)FreeMono24pt7bBlankRows
 };
 
 // Approx. 6330 bytes
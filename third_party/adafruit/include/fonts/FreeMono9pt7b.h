@@ -201,10 +201,28 @@ const GFXglyph FreeMono9pt7bGlyphs[] = {
   { 841, 7,  3,  11, 2, -6  }
 };                                        // 0x7E '~'
 
-GFXfont FreeMono9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMono9pt7bBlankRows[] = {
+  0, 0, 7, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 4, 2, 3, 0, 0, 1, 2, 0, 0, 6, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMono9pt7b = {
   (uint8_t *)FreeMono9pt7bBitmaps,
   (GFXglyph *)FreeMono9pt7bGlyphs,
-  0x20,                           0x7E,18, 0, 0, 0, 0
+  0x20,                           0x7E,18, 15, 11, 0, -11, 1, NULL, 0,
+  (uint8_t *)FreeMono9pt7bBlankRows
 };
 
 // Approx. 1516 bytes
@@ -275,10 +275,28 @@ const GFXglyph FreeMonoBold12pt7bGlyphs[] = {
   { 1724, 12, 4,  14, 1,  -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoBold12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoBold12pt7bBlankRows[] = {
+  0, 0, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 5, 3, 5, 0, 0, 2, 3, 0, 0, 10, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 18, 1, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoBold12pt7b = {
   (uint8_t *)FreeMonoBold12pt7bBitmaps,
   (GFXglyph *)FreeMonoBold12pt7bGlyphs,
-  0x20,                                0x7E,24, 0, 0, 0, 0
+  0x20,                                0x7E,24, 22, 16, -1, -16, 1, NULL, 0,
+  (uint8_t *)FreeMonoBold12pt7bBlankRows
 };
 
 // Approx. 2402 bytes
@@ -448,10 +448,28 @@ const GFXglyph FreeMonoBold18pt7bGlyphs[] = {
   { 3796, 17, 8,  21, 2,  -13 }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoBold18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoBold18pt7bBlankRows[] = {
+  0, 0, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 6, 5, 6, 0, 0, 4, 2, 0, 0, 14, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 2, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoBold18pt7b = {
   (uint8_t *)FreeMonoBold18pt7bBitmaps,
   (GFXglyph *)FreeMonoBold18pt7bGlyphs,
-  0x20,                                0x7E,35, 0, 0, 0, 0
+  0x20,                                0x7E,35, 31, 23, -1, -23, 1, NULL, 0,
+  (uint8_t *)FreeMonoBold18pt7bBlankRows
 };
 
 // Approx. 4485 bytes
@@ -697,10 +697,28 @@ const GFXglyph FreeMonoBold24pt7bGlyphs[] = {
   { 6769, 22, 10, 28, 3,  -17 }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoBold24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoBold24pt7bBlankRows[] = {
+  0, 0, 22, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 10, 6, 9, 0, 0, 5, 4, 21, 1, 19, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 3, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoBold24pt7b = {
   (uint8_t *)FreeMonoBold24pt7bBitmaps,
   (GFXglyph *)FreeMonoBold24pt7bGlyphs,
-  0x20,                                0x7E,47, 0, 0, 0, 0
+  0x20,                                0x7E,47, 42, 31, -1, -32, 1, NULL, 0,
+  (uint8_t *)FreeMonoBold24pt7bBlankRows
 };
 
 // Approx. 7469 bytes
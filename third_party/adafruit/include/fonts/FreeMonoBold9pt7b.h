@@ -214,10 +214,28 @@ const GFXglyph FreeMonoBold9pt7bGlyphs[] = {
   { 995, 9,  4,  11, 1, -6  }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoBold9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoBold9pt7bBlankRows[] = {
+  0, 0, 8, 1, 0, 0, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 4, 2, 4, 0, 0, 2, 2, 0, 0, 6, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoBold9pt7b = {
   (uint8_t *)FreeMonoBold9pt7bBitmaps,
   (GFXglyph *)FreeMonoBold9pt7bGlyphs,
-  0x20,                               0x7E,18, 0, 0, 0, 0
+  0x20,                               0x7E,18, 17, 11, 0, -12, 1, NULL, 0,
+  (uint8_t *)FreeMonoBold9pt7bBlankRows
 };
 
 // Approx. 1672 bytes
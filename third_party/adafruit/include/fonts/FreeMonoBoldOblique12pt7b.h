@@ -294,10 +294,28 @@ const GFXglyph FreeMonoBoldOblique12pt7bGlyphs[] = {
   { 1960, 12, 4,  14, 3,  -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoBoldOblique12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoBoldOblique12pt7bBlankRows[] = {
+  0, 0, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 5, 3, 5, 0, 0, 2, 3, 0, 0, 10, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoBoldOblique12pt7b = {
   (uint8_t *)FreeMonoBoldOblique12pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique12pt7bGlyphs,
-  0x20,                                       0x7E,24, 0, 0, 0, 0
+  0x20,                                       0x7E,24, 22, 18, -1, -16, 1, NULL, 0,
+  (uint8_t *)FreeMonoBoldOblique12pt7bBlankRows
 };
 
 // Approx. 2638 bytes
@@ -485,10 +485,28 @@ const GFXglyph FreeMonoBoldOblique18pt7bGlyphs[] = {
   { 4239, 17, 8,  21, 4,  -13 }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoBoldOblique18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoBoldOblique18pt7bBlankRows[] = {
+  0, 0, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 6, 5, 6, 0, 0, 4, 2, 0, 0, 15, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 2, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoBoldOblique18pt7b = {
   (uint8_t *)FreeMonoBoldOblique18pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique18pt7bGlyphs,
-  0x20,                                       0x7E,35, 0, 0, 0, 0
+  0x20,                                       0x7E,35, 31, 25, -1, -23, 1, NULL, 0,
+  (uint8_t *)FreeMonoBoldOblique18pt7bBlankRows
 };
 
 // Approx. 4928 bytes
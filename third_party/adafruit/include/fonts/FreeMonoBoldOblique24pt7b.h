@@ -767,10 +767,28 @@ const GFXglyph FreeMonoBoldOblique24pt7bGlyphs[] = {
   { 7606, 23, 10, 28, 5,  -17 }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoBoldOblique24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoBoldOblique24pt7bBlankRows[] = {
+  0, 0, 22, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 10, 6, 9, 0, 0, 5, 4, 21, 1, 20, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 3, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoBoldOblique24pt7b = {
   (uint8_t *)FreeMonoBoldOblique24pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique24pt7bGlyphs,
-  0x20,                                       0x7E,47, 0, 0, 0, 0
+  0x20,                                       0x7E,47, 42, 34, -2, -32, 1, NULL, 0,
+  (uint8_t *)FreeMonoBoldOblique24pt7bBlankRows
 };
 
 // Approx. 8307 bytes
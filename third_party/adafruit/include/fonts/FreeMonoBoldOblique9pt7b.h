@@ -228,10 +228,28 @@ const GFXglyph FreeMonoBoldOblique9pt7bGlyphs[] = {
   { 1162, 9,  4,  11, 2,  -6  }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoBoldOblique9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoBoldOblique9pt7bBlankRows[] = {
+  0, 0, 8, 1, 0, 0, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 4, 2, 4, 0, 0, 2, 2, 0, 0, 8, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoBoldOblique9pt7b = {
   (uint8_t *)FreeMonoBoldOblique9pt7bBitmaps,
   (GFXglyph *)FreeMonoBoldOblique9pt7bGlyphs,
-  0x20,                                      0x7E,18, 0, 0, 0, 0
+  0x20,                                      0x7E,18, 17, 13, -1, -12, 1, NULL, 0,
+  (uint8_t *)FreeMonoBoldOblique9pt7bBlankRows
 };
 
 // Approx. 1839 bytes
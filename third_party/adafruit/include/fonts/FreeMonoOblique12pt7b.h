@@ -273,10 +273,28 @@ const GFXglyph FreeMonoOblique12pt7bGlyphs[] = {
   { 1702, 11, 3,  14, 3,  -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoOblique12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoOblique12pt7bBlankRows[] = {
+  0, 0, 10, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 4, 3, 4, 0, 0, 1, 2, 0, 0, 9, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 2, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoOblique12pt7b = {
   (uint8_t *)FreeMonoOblique12pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique12pt7bGlyphs,
-  0x20,                                   0x7E,24, 0, 0, 0, 0
+  0x20,                                   0x7E,24, 20, 17, -1, -15, 1, NULL, 0,
+  (uint8_t *)FreeMonoOblique12pt7bBlankRows
 };
 
 // Approx. 2379 bytes
@@ -668,10 +668,28 @@ const GFXglyph FreeMonoOblique24pt7bGlyphs[] = {
   { 6437, 20, 6,  28, 7,  -15 }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoOblique24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoOblique24pt7bBlankRows[] = {
+  0, 0, 19, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 9, 6, 7, 0, 0, 2, 5, 0, 0, 18, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 4, 5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoOblique24pt7b = {
   (uint8_t *)FreeMonoOblique24pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique24pt7bGlyphs,
-  0x20,                                   0x7E,47, 0, 0, 0, 0
+  0x20,                                   0x7E,47, 40, 32, -1, -30, 1, NULL, 0,
+  (uint8_t *)FreeMonoOblique24pt7bBlankRows
 };
 
 // Approx. 7124 bytes
@@ -212,10 +212,28 @@ const GFXglyph FreeMonoOblique9pt7bGlyphs[] = {
   { 979, 7,  3,  11, 3, -6  }
 };                                        // 0x7E '~'
 
-GFXfont FreeMonoOblique9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeMonoOblique9pt7bBlankRows[] = {
+  0, 0, 7, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 7, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 4, 2, 3, 0, 0, 1, 2, 0, 0, 7, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeMonoOblique9pt7b = {
   (uint8_t *)FreeMonoOblique9pt7bBitmaps,
   (GFXglyph *)FreeMonoOblique9pt7bGlyphs,
-  0x20,                                  0x7E,18, 0, 0, 0, 0
+  0x20,                                  0x7E,18, 15, 13, 0, -11, 1, NULL, 0,
+  (uint8_t *)FreeMonoOblique9pt7bBlankRows
 };
 
 // Approx. 1654 bytes
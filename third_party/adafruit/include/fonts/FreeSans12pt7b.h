@@ -295,10 +295,28 @@ const GFXglyph FreeSans12pt7bGlyphs[] = {
   { 1962, 10, 5,  12, 1,  -10 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSans12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSans12pt7bBlankRows[] = {
+  0, 0, 14, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 9, 2, 8, 0, 0, 2, 2, 0, 0, 14, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 3, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSans12pt7b = {
   (uint8_t *)FreeSans12pt7bBitmaps,
   (GFXglyph *)FreeSans12pt7bGlyphs,
-  0x20,                            0x7E,29, 0, 0, 0, 0
+  0x20,                            0x7E,29, 23, 24, -1, -17, 1, NULL, 0,
+  (uint8_t *)FreeSans12pt7bBlankRows
 };
 
 // Approx. 2641 bytes
@@ -477,10 +477,28 @@ const GFXglyph FreeSans18pt7bGlyphs[] = {
   { 4145, 15, 7,  18, 1,  -15 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSans18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSans18pt7bBlankRows[] = {
+  0, 0, 20, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 11, 4, 11, 0, 0, 3, 3, 0, 0, 19, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSans18pt7b = {
   (uint8_t *)FreeSans18pt7bBitmaps,
   (GFXglyph *)FreeSans18pt7bGlyphs,
-  0x20,                            0x7E,42, 0, 0, 0, 0
+  0x20,                            0x7E,42, 35, 36, -1, -26, 1, NULL, 0,
+  (uint8_t *)FreeSans18pt7bBlankRows
 };
 
 // Approx. 4831 bytes
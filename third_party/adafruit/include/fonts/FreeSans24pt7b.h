@@ -752,10 +752,28 @@ const GFXglyph FreeSans24pt7bGlyphs[] = {
   { 7447, 19, 7,  24, 2,  -19 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSans24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSans24pt7bBlankRows[] = {
+  0, 0, 26, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 15, 5, 15, 0, 0, 4, 4, 0, 0, 26, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 4, 5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSans24pt7b = {
   (uint8_t *)FreeSans24pt7bBitmaps,
   (GFXglyph *)FreeSans24pt7bGlyphs,
-  0x20,                            0x7E,56, 0, 0, 0, 0
+  0x20,                            0x7E,56, 45, 48, -1, -34, 1, NULL, 0,
+  (uint8_t *)FreeSans24pt7bBlankRows
 };
 
 // Approx. 8136 bytes
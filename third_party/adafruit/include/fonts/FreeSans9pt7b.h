@@ -226,10 +226,28 @@ const GFXglyph FreeSans9pt7bGlyphs[] = {
   { 1147, 7,  3,  9,  1, -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSans9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSans9pt7bBlankRows[] = {
+  0, 0, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 8, 1, 7, 0, 0, 1, 2, 0, 0, 10, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSans9pt7b = {
   (uint8_t *)FreeSans9pt7bBitmaps,
   (GFXglyph *)FreeSans9pt7bGlyphs,
-  0x20,                           0x7E,22, 0, 0, 0, 0
+  0x20,                           0x7E,22, 18, 18, 0, -13, 1, NULL, 0,
+  (uint8_t *)FreeSans9pt7bBlankRows
 };
 
 // Approx. 1822 bytes
@@ -313,10 +313,28 @@ const GFXglyph FreeSansBold12pt7bGlyphs[] = {
   { 2178, 12, 5,  12, 0,  -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansBold12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansBold12pt7bBlankRows[] = {
+  0, 0, 13, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 6, 3, 6, 0, 0, 3, 3, 0, 0, 14, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 18, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 2, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansBold12pt7b = {
   (uint8_t *)FreeSansBold12pt7bBitmaps,
   (GFXglyph *)FreeSansBold12pt7bGlyphs,
-  0x20,                                0x7E,29, 0, 0, 0, 0
+  0x20,                                0x7E,29, 23, 23, -1, -17, 1, NULL, 0,
+  (uint8_t *)FreeSansBold12pt7bBlankRows
 };
 
 // Approx. 2858 bytes
@@ -506,10 +506,28 @@ const GFXglyph FreeSansBold18pt7bGlyphs[] = {
   { 4491, 15, 6,  18, 1,  -10 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansBold18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansBold18pt7bBlankRows[] = {
+  0, 0, 18, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 8, 5, 8, 0, 0, 4, 4, 0, 0, 19, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansBold18pt7b = {
   (uint8_t *)FreeSansBold18pt7bBitmaps,
   (GFXglyph *)FreeSansBold18pt7bGlyphs,
-  0x20,                                0x7E,42, 0, 0, 0, 0
+  0x20,                                0x7E,42, 33, 34, -1, -25, 1, NULL, 0,
+  (uint8_t *)FreeSansBold18pt7bBlankRows
 };
 
 // Approx. 5175 bytes
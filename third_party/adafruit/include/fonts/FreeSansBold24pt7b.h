@@ -809,10 +809,28 @@ const GFXglyph FreeSansBold24pt7bGlyphs[] = {
   { 8122, 21, 8,  23, 1,  -14 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansBold24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansBold24pt7bBlankRows[] = {
+  0, 0, 24, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 11, 7, 11, 0, 0, 6, 6, 0, 0, 25, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 3, 6, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansBold24pt7b = {
   (uint8_t *)FreeSansBold24pt7bBitmaps,
   (GFXglyph *)FreeSansBold24pt7bGlyphs,
-  0x20,                                0x7E,56, 0, 0, 0, 0
+  0x20,                                0x7E,56, 47, 46, -1, -35, 1, NULL, 0,
+  (uint8_t *)FreeSansBold24pt7bBlankRows
 };
 
 // Approx. 8815 bytes
@@ -233,10 +233,28 @@ const GFXglyph FreeSansBold9pt7bGlyphs[] = {
   { 1228, 8,  2,  9,  0, -4  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansBold9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansBold9pt7bBlankRows[] = {
+  0, 0, 10, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 5, 2, 5, 0, 0, 2, 2, 0, 0, 10, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansBold9pt7b = {
   (uint8_t *)FreeSansBold9pt7bBitmaps,
   (GFXglyph *)FreeSansBold9pt7bGlyphs,
-  0x20,                               0x7E,22, 0, 0, 0, 0
+  0x20,                               0x7E,22, 18, 18, 0, -13, 1, NULL, 0,
+  (uint8_t *)FreeSansBold9pt7bBlankRows
 };
 
 // Approx. 1902 bytes
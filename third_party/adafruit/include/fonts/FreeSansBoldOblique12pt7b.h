@@ -342,10 +342,28 @@ const GFXglyph FreeSansBoldOblique12pt7bGlyphs[] = {
   { 2527, 12, 5,  14, 2,  -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansBoldOblique12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansBoldOblique12pt7bBlankRows[] = {
+  0, 0, 13, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 6, 3, 6, 0, 0, 3, 3, 11, 1, 14, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 2, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansBoldOblique12pt7b = {
   (uint8_t *)FreeSansBoldOblique12pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique12pt7bGlyphs,
-  0x20,                                       0x7E,29, 0, 0, 0, 0
+  0x20,                                       0x7E,29, 28, 23, -2, -22, 1, NULL, 0,
+  (uint8_t *)FreeSansBoldOblique12pt7bBlankRows
 };
 
 // Approx. 3207 bytes
@@ -570,10 +570,28 @@ const GFXglyph FreeSansBoldOblique18pt7bGlyphs[] = {
   { 5258, 17, 6,  20, 3,  -10 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansBoldOblique18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansBoldOblique18pt7bBlankRows[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 8, 5, 8, 0, 0, 4, 4, 0, 0, 19, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 32, 1, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansBoldOblique18pt7b = {
   (uint8_t *)FreeSansBoldOblique18pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique18pt7bGlyphs,
-  0x20,                                       0x7E,42, 0, 0, 0, 0
+  0x20,                                       0x7E,42, 35, 34, -2, -26, 1, NULL, 0,
+  (uint8_t *)FreeSansBoldOblique18pt7bBlankRows
 };
 
 // Approx. 5943 bytes
@@ -918,10 +918,28 @@ const GFXglyph FreeSansBoldOblique24pt7bGlyphs[] = {
   { 9425, 22, 8,  27, 5,  -14 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansBoldOblique24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansBoldOblique24pt7bBlankRows[] = {
+  0, 0, 25, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 11, 7, 11, 0, 0, 6, 6, 0, 0, 25, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 3, 6, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansBoldOblique24pt7b = {
   (uint8_t *)FreeSansBoldOblique24pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique24pt7bGlyphs,
-  0x20,                                       0x7E,56, 0, 0, 0, 0
+  0x20,                                       0x7E,56, 46, 46, -3, -35, 1, NULL, 0,
+  (uint8_t *)FreeSansBoldOblique24pt7bBlankRows
 };
 
 // Approx. 10119 bytes
@@ -252,10 +252,28 @@ const GFXglyph FreeSansBoldOblique9pt7bGlyphs[] = {
   { 1462, 8,  2,  11, 2,  -4  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansBoldOblique9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansBoldOblique9pt7bBlankRows[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 5, 2, 4, 0, 0, 2, 2, 8, 1, 10, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansBoldOblique9pt7b = {
   (uint8_t *)FreeSansBoldOblique9pt7bBitmaps,
   (GFXglyph *)FreeSansBoldOblique9pt7bGlyphs,
-  0x20,                                      0x7E,22, 0, 0, 0, 0
+  0x20,                                      0x7E,22, 21, 18, -2, -16, 1, NULL, 0,
+  (uint8_t *)FreeSansBoldOblique9pt7bBlankRows
 };
 
 // Approx. 2136 bytes
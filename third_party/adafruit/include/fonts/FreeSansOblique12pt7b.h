@@ -327,10 +327,28 @@ const GFXglyph FreeSansOblique12pt7bGlyphs[] = {
   { 2355, 11, 5,  14, 3,  -10 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansOblique12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansOblique12pt7bBlankRows[] = {
+  0, 0, 14, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 8, 2, 8, 0, 0, 2, 2, 11, 1, 13, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 3, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansOblique12pt7b = {
   (uint8_t *)FreeSansOblique12pt7bBitmaps,
   (GFXglyph *)FreeSansOblique12pt7bGlyphs,
-  0x20,                                   0x7E,29, 0, 0, 0, 0
+  0x20,                                   0x7E,29, 24, 24, -1, -17, 1, NULL, 0,
+  (uint8_t *)FreeSansOblique12pt7bBlankRows
 };
 
 // Approx. 3034 bytes
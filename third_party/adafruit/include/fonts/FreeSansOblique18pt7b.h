@@ -543,10 +543,28 @@ const GFXglyph FreeSansOblique18pt7bGlyphs[] = {
   { 4937, 16, 7,  20, 5,  -15 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansOblique18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansOblique18pt7bBlankRows[] = {
+  0, 0, 20, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 11, 4, 12, 0, 0, 3, 3, 0, 0, 19, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 3, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansOblique18pt7b = {
   (uint8_t *)FreeSansOblique18pt7bBitmaps,
   (GFXglyph *)FreeSansOblique18pt7bGlyphs,
-  0x20,                                   0x7E,42, 0, 0, 0, 0
+  0x20,                                   0x7E,42, 35, 36, -2, -26, 1, NULL, 0,
+  (uint8_t *)FreeSansOblique18pt7bBlankRows
 };
 
 // Approx. 5623 bytes
@@ -865,10 +865,28 @@ const GFXglyph FreeSansOblique24pt7bGlyphs[] = {
   { 8792, 21, 7,  27, 6,  -19 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansOblique24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansOblique24pt7bBlankRows[] = {
+  0, 0, 26, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 15, 5, 15, 0, 0, 4, 4, 0, 0, 26, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 37, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 4, 5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansOblique24pt7b = {
   (uint8_t *)FreeSansOblique24pt7bBitmaps,
   (GFXglyph *)FreeSansOblique24pt7bGlyphs,
-  0x20,                                   0x7E,56, 0, 0, 0, 0
+  0x20,                                   0x7E,56, 46, 48, -3, -35, 1, NULL, 0,
+  (uint8_t *)FreeSansOblique24pt7bBlankRows
 };
 
 // Approx. 9483 bytes
@@ -245,10 +245,28 @@ const GFXglyph FreeSansOblique9pt7bGlyphs[] = {
   { 1365, 9,  3,  11, 2,  -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSansOblique9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSansOblique9pt7bBlankRows[] = {
+  0, 0, 11, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 7, 1, 6, 0, 0, 1, 2, 8, 1, 9, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 16, 1, 0, 0, 0, 0
+};
+
+const GFXfont FreeSansOblique9pt7b = {
   (uint8_t *)FreeSansOblique9pt7bBitmaps,
   (GFXglyph *)FreeSansOblique9pt7bGlyphs,
-  0x20,                                  0x7E,22, 0, 0, 0, 0
+  0x20,                                  0x7E,22, 18, 18, -1, -13, 1, NULL, 0,
+  (uint8_t *)FreeSansOblique9pt7bBlankRows
 };
 
 // Approx. 2041 bytes
@@ -284,10 +284,28 @@ const GFXglyph FreeSerif12pt7bGlyphs[] = {
   { 1834, 12, 3,  12, 0, -6  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerif12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerif12pt7bBlankRows[] = {
+  0, 0, 11, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 6, 3, 6, 0, 0, 1, 4, 12, 1, 12, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 3, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerif12pt7b = {
   (uint8_t *)FreeSerif12pt7bBitmaps,
   (GFXglyph *)FreeSerif12pt7bGlyphs,
-  0x20,                             0x7E,29, 0, 0, 0, 0
+  0x20,                             0x7E,29, 22, 23, 0, -16, 1, NULL, 0,
+  (uint8_t *)FreeSerif12pt7bBlankRows
 };
 
 // Approx. 2511 bytes
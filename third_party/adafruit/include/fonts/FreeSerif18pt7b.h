@@ -454,10 +454,28 @@ const GFXglyph FreeSerif18pt7bGlyphs[] = {
   { 3878, 16, 4,  17, 1, -10 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerif18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerif18pt7bBlankRows[] = {
+  0, 0, 17, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 9, 4, 9, 0, 0, 2, 5, 0, 0, 19, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerif18pt7b = {
   (uint8_t *)FreeSerif18pt7bBitmaps,
   (GFXglyph *)FreeSerif18pt7bGlyphs,
-  0x20,                             0x7E,42, 0, 0, 0, 0
+  0x20,                             0x7E,42, 33, 33, 0, -24, 1, NULL, 0,
+  (uint8_t *)FreeSerif18pt7bBlankRows
 };
 
 // Approx. 4558 bytes
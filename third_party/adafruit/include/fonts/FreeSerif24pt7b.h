@@ -715,10 +715,28 @@ const GFXglyph FreeSerif24pt7bGlyphs[] = {
   { 6996, 22, 5,  23, 1, -13 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerif24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerif24pt7bBlankRows[] = {
+  0, 0, 24, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 12, 5, 11, 0, 0, 2, 7, 24, 1, 24, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 6, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerif24pt7b = {
   (uint8_t *)FreeSerif24pt7bBitmaps,
   (GFXglyph *)FreeSerif24pt7bGlyphs,
-  0x20,                             0x7E,56, 0, 0, 0, 0
+  0x20,                             0x7E,56, 44, 45, 0, -33, 1, NULL, 0,
+  (uint8_t *)FreeSerif24pt7bBlankRows
 };
 
 // Approx. 7682 bytes
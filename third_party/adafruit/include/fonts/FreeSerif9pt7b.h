@@ -220,10 +220,28 @@ const GFXglyph FreeSerif9pt7bGlyphs[] = {
   { 1076, 9,  3,  9,  0, -5  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerif9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerif9pt7bBlankRows[] = {
+  0, 0, 8, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 4, 2, 5, 0, 0, 1, 3, 0, 0, 11, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerif9pt7b = {
   (uint8_t *)FreeSerif9pt7bBitmaps,
   (GFXglyph *)FreeSerif9pt7bGlyphs,
-  0x20,                            0x7E,22, 0, 0, 0, 0
+  0x20,                            0x7E,22, 17, 17, 0, -12, 1, NULL, 0,
+  (uint8_t *)FreeSerif9pt7bBlankRows
 };
 
 // Approx. 1752 bytes
@@ -296,10 +296,28 @@ const GFXglyph FreeSerifBold12pt7bGlyphs[] = {
   { 1985, 11, 4,  12, 1,  -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifBold12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifBold12pt7bBlankRows[] = {
+  0, 0, 10, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 3, 4, 3, 13, 1, 2, 4, 0, 0, 10, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 1, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifBold12pt7b = {
   (uint8_t *)FreeSerifBold12pt7bBitmaps,
   (GFXglyph *)FreeSerifBold12pt7bGlyphs,
-  0x20,                                 0x7E,29, 0, 0, 0, 0
+  0x20,                                 0x7E,29, 23, 24, -1, -17, 1, NULL, 0,
+  (uint8_t *)FreeSerifBold12pt7bBlankRows
 };
 
 // Approx. 2663 bytes
@@ -487,10 +487,28 @@ const GFXglyph FreeSerifBold18pt7bGlyphs[] = {
   { 4263, 16, 5,  18, 1,  -11 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifBold18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifBold18pt7bBlankRows[] = {
+  0, 0, 15, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 4, 6, 4, 19, 1, 3, 6, 19, 1, 16, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 3, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifBold18pt7b = {
   (uint8_t *)FreeSerifBold18pt7bBitmaps,
   (GFXglyph *)FreeSerifBold18pt7bGlyphs,
-  0x20,                                 0x7E,42, 0, 0, 0, 0
+  0x20,                                 0x7E,42, 33, 35, -1, -25, 1, NULL, 0,
+  (uint8_t *)FreeSerifBold18pt7bBlankRows
 };
 
 // Approx. 4945 bytes
@@ -784,10 +784,28 @@ const GFXglyph FreeSerifBold24pt7bGlyphs[] = {
   { 7827, 22, 7,  24, 1,  -14 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifBold24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifBold24pt7bBlankRows[] = {
+  0, 0, 22, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 8, 8, 8, 7, 0, 0, 5, 7, 0, 0, 22, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 7, 4, 7, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifBold24pt7b = {
   (uint8_t *)FreeSerifBold24pt7bBitmaps,
   (GFXglyph *)FreeSerifBold24pt7bGlyphs,
-  0x20,                                 0x7E,56, 0, 0, 0, 0
+  0x20,                                 0x7E,56, 44, 47, -1, -34, 1, NULL, 0,
+  (uint8_t *)FreeSerifBold24pt7bBlankRows
 };
 
 // Approx. 8519 bytes
@@ -227,10 +227,28 @@ const GFXglyph FreeSerifBold9pt7bGlyphs[] = {
   { 1160, 8,  2,  9,  1, -4  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifBold9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifBold9pt7bBlankRows[] = {
+  0, 0, 8, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 1, 3, 9, 1, 8, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifBold9pt7b = {
   (uint8_t *)FreeSerifBold9pt7bBitmaps,
   (GFXglyph *)FreeSerifBold9pt7bGlyphs,
-  0x20,                                0x7E,22, 0, 0, 0, 0
+  0x20,                                0x7E,22, 17, 18, 0, -12, 1, NULL, 0,
+  (uint8_t *)FreeSerifBold9pt7bBlankRows
 };
 
 // Approx. 1834 bytes
@@ -317,10 +317,28 @@ const GFXglyph FreeSerifBoldItalic12pt7bGlyphs[] = {
   { 2232, 11, 4,  14, 1,  -7  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifBoldItalic12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifBoldItalic12pt7bBlankRows[] = {
+  0, 0, 11, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 20, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 2, 2, 0, 0, 11, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 2, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifBoldItalic12pt7b = {
   (uint8_t *)FreeSerifBoldItalic12pt7bBitmaps,
   (GFXglyph *)FreeSerifBoldItalic12pt7bGlyphs,
-  0x20,                                       0x7E,29, 0, 0, 0, 0
+  0x20,                                       0x7E,29, 23, 23, -3, -17, 1, NULL, 0,
+  (uint8_t *)FreeSerifBoldItalic12pt7bBlankRows
 };
 
 // Approx. 2910 bytes
@@ -525,10 +525,28 @@ const GFXglyph FreeSerifBoldItalic18pt7bGlyphs[] = {
   { 4728, 16, 5,  20, 2,  -11 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifBoldItalic18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifBoldItalic18pt7bBlankRows[] = {
+  0, 0, 17, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 7, 5, 6, 0, 0, 3, 4, 0, 0, 17, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 3, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifBoldItalic18pt7b = {
   (uint8_t *)FreeSerifBoldItalic18pt7bBitmaps,
   (GFXglyph *)FreeSerifBoldItalic18pt7bGlyphs,
-  0x20,                                       0x7E,42, 0, 0, 0, 0
+  0x20,                                       0x7E,42, 33, 33, -5, -25, 1, NULL, 0,
+  (uint8_t *)FreeSerifBoldItalic18pt7bBlankRows
 };
 
 // Approx. 5410 bytes
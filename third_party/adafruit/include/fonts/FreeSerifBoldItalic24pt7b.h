@@ -818,10 +818,28 @@ const GFXglyph FreeSerifBoldItalic24pt7bGlyphs[] = {
   { 8226, 21, 7,  27, 3,  -14 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifBoldItalic24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifBoldItalic24pt7bBlankRows[] = {
+  0, 0, 22, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  40, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 8, 7, 8, 0, 0, 4, 6, 0, 0, 22, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 4, 6, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifBoldItalic24pt7b = {
   (uint8_t *)FreeSerifBoldItalic24pt7bBitmaps,
   (GFXglyph *)FreeSerifBoldItalic24pt7bGlyphs,
-  0x20,                                       0x7E,56, 0, 0, 0, 0
+  0x20,                                       0x7E,56, 44, 44, -6, -33, 1, NULL, 0,
+  (uint8_t *)FreeSerifBoldItalic24pt7bBlankRows
 };
 
 // Approx. 8917 bytes
@@ -240,10 +240,28 @@ const GFXglyph FreeSerifBoldItalic9pt7bGlyphs[] = {
   { 1308, 8,  2,  10, 1,  -4  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifBoldItalic9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifBoldItalic9pt7bBlankRows[] = {
+  0, 0, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 15, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 1, 3, 0, 0, 9, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifBoldItalic9pt7b = {
   (uint8_t *)FreeSerifBoldItalic9pt7bBitmaps,
   (GFXglyph *)FreeSerifBoldItalic9pt7bGlyphs,
-  0x20,                                      0x7E,22, 0, 0, 0, 0
+  0x20,                                      0x7E,22, 17, 17, -2, -12, 1, NULL, 0,
+  (uint8_t *)FreeSerifBoldItalic9pt7bBlankRows
 };
 
 // Approx. 1982 bytes
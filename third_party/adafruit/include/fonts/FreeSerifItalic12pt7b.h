@@ -296,10 +296,28 @@ const GFXglyph FreeSerifItalic12pt7bGlyphs[] = {
   { 1979, 11, 3,  13, 1,  -6  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifItalic12pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifItalic12pt7bBlankRows[] = {
+  0, 0, 12, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 5, 3, 6, 0, 0, 1, 4, 0, 0, 11, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 2, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifItalic12pt7b = {
   (uint8_t *)FreeSerifItalic12pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic12pt7bGlyphs,
-  0x20,                                   0x7E,29, 0, 0, 0, 0
+  0x20,                                   0x7E,29, 23, 21, -2, -17, 1, NULL, 0,
+  (uint8_t *)FreeSerifItalic12pt7bBlankRows
 };
 
 // Approx. 2656 bytes
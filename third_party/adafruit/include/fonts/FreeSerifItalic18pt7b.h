@@ -475,10 +475,28 @@ const GFXglyph FreeSerifItalic18pt7bGlyphs[] = {
   { 4124, 17, 4,  19, 1,  -10 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifItalic18pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifItalic18pt7bBlankRows[] = {
+  0, 0, 17, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 7, 4, 7, 0, 0, 2, 5, 0, 0, 16, 3,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 4, 4, 4, 4, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifItalic18pt7b = {
   (uint8_t *)FreeSerifItalic18pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic18pt7bGlyphs,
-  0x20,                                   0x7E,42, 0, 0, 0, 0
+  0x20,                                   0x7E,42, 33, 31, -3, -25, 1, NULL, 0,
+  (uint8_t *)FreeSerifItalic18pt7bBlankRows
 };
 
 // Approx. 4805 bytes
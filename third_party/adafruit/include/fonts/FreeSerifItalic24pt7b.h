@@ -762,10 +762,28 @@ const GFXglyph FreeSerifItalic24pt7bGlyphs[] = {
   { 7562, 22, 6,  25, 2,  -14 }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifItalic24pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifItalic24pt7bBlankRows[] = {
+  0, 0, 23, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 12, 5, 11, 0, 0, 3, 6, 0, 0, 24, 4,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifItalic24pt7b = {
   (uint8_t *)FreeSerifItalic24pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic24pt7bGlyphs,
-  0x20,                                   0x7E,56, 0, 0, 0, 0
+  0x20,                                   0x7E,56, 44, 42, -4, -33, 1, NULL, 0,
+  (uint8_t *)FreeSerifItalic24pt7bBlankRows
 };
 
 // Approx. 8251 bytes
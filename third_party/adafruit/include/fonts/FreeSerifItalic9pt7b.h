@@ -227,10 +227,28 @@ const GFXglyph FreeSerifItalic9pt7bGlyphs[] = {
   { 1160, 8,  3,  10, 1,  -5  }
 };                                        // 0x7E '~'
 
-GFXfont FreeSerifItalic9pt7b = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t FreeSerifItalic9pt7bBlankRows[] = {
+  0, 0, 9, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 4, 2, 4, 0, 0, 1, 3, 0, 0, 10, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 3, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont FreeSerifItalic9pt7b = {
   (uint8_t *)FreeSerifItalic9pt7bBitmaps,
   (GFXglyph *)FreeSerifItalic9pt7bGlyphs,
-  0x20,                                  0x7E,22, 0, 0, 0, 0
+  0x20,                                  0x7E,22, 17, 16, -1, -12, 1, NULL, 0,
+  (uint8_t *)FreeSerifItalic9pt7bBlankRows
 };
 
 // Approx. 1835 bytes
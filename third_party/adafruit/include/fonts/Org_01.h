@@ -156,10 +156,28 @@ const GFXglyph Org_01Glyphs[] = {
   { 269, 5, 3, 6, 0, -3 }
 };                                        // 0x7E '~'
 
-GFXfont Org_01 = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t Org_01BlankRows[] = {
+  0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 2, 1, 1, 0, 0, 1, 1, 0, 0, 3, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont Org_01 = {
   (uint8_t *)Org_01Bitmaps,
   (GFXglyph *)Org_01Glyphs,
-  0x20,                    0x7E,7, 0, 0, 0, 0
+  0x20,                    0x7E,7, 6, 6, 0, -4, 1, NULL, 0,
+  (uint8_t *)Org_01BlankRows
 };
 
 // Approx. 943 bytes
@@ -148,10 +148,28 @@ const GFXglyph PicopixelGlyphs[] = {
   { 179, 4, 2, 5, 0, -3 }
 };                                        // 0x7E '~'
 
-GFXfont Picopixel = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t PicopixelBlankRows[] = {
+  0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 3, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const GFXfont Picopixel = {
   (uint8_t *)PicopixelBitmaps,
   (GFXglyph *)PicopixelGlyphs,
-  0x20,                       0x7E,7, 0, 0, 0, 0
+  0x20,                       0x7E,7, 6, 6, 0, -4, 1, NULL, 0,
+  (uint8_t *)PicopixelBlankRows
 };
 
 // Approx. 852 bytes
@@ -471,9 +471,27 @@ const GFXglyph TomThumbGlyphs[] = {
 #endif /* (TOMTHUMB_USE_EXTENDED) */
 };
 
-GFXfont TomThumb = {
+// First row and number of rows of the tallest band of blank rows inside
+// each glyph, which printing skips.
+const uint8_t TomThumbBlankRows[] = {
+  0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 3, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0
+};
+
+const GFXfont TomThumb = {
   (uint8_t *)TomThumbBitmaps,
   (GFXglyph *)TomThumbGlyphs,
-  0x20,                      0x7E,6, 0, 0, 0, 0
+  0x20,                      0x7E,6, 6, 8, 0, -5, 1, NULL, 0,
+  (uint8_t *)TomThumbBlankRows
 };
 #endif // __FONT_TOMTHUMB_H
@@ -42,14 +42,29 @@ typedef struct {             // Data stored PER GLYPH
 typedef struct {         // Data stored for FONT AS A WHOLE:
   uint8_t * bitmap;      // Glyph bitmaps, concatenated
   GFXglyph *glyph;       // Glyph array
-  uint8_t   first, last; // ASCII extents
+  uint8_t   first, last; // ASCII extents, unless codepoints is set
   uint8_t   yAdvance;    // Newline distance (y axis)
 
-  // Added(pimvanpelt) for framebuffer rendering.
+  // Added(pimvanpelt) for framebuffer rendering. Fonts without them are
+  // analyzed into a copy when selected.
   int8_t    font_height;      // Maximum per-glyph height
   int8_t    font_width;       // Maximum per-glyph width
   int8_t    font_min_xOffset; // Left-most glyph xOffset
   int8_t    font_min_yOffset; // Left-most glyph yOffset
+
+  // Bits of coverage per pixel: 0 or 1 for monochrome fonts, 2 or 4 for
+  // anti-aliased fonts made by contrib/fontconvert.
+  uint8_t   bpp;
+
+  // Sparse fonts: sorted code points of the nglyphs glyphs, for fonts with
+  // characters beyond 0xFF. NULL for fonts covering first to last.
+  uint32_t *codepoints;
+  uint16_t  nglyphs;
+
+  // Optional: per glyph, the first row and number of rows of its tallest
+  // band of blank rows, which printing skips. Written by contrib/fontconvert,
+  // along with the metrics above, so that fonts can be const.
+  uint8_t * blankRows;
 } GFXfont;
 
 enum GFXfont_t {
@@ -31,15 +31,47 @@
 
 #include "mgos_ili9341.h"
 
-static void ili9341_drawCircleHelper(uint16_t x0, uint16_t y0, uint16_t r, uint8_t cornername) {
+#include "mgos_ili9341_hal.h"
+
+// Circles are rasterized as runs rather than pixels. The midpoint walk over
+// one octant yields, per step, a point (x, y) and its transpose (y, x). For
+// the first quadrant, points sharing a y form a horizontal run on row y,
+// and transposed points sharing a y form a vertical run on column y. Callers
+// mirror these runs into the other quadrants, merging the two halves of a
+// run that touches an axis into a single span.
+typedef void (*ili9341_circle_run_cb)(bool vertical, int16_t c, int16_t a, int16_t b, void *arg);
+
+// Filled circles only need the extent w of each row d, which is reported
+// once per row for d in [0, r].
+typedef void (*ili9341_circle_row_cb)(int16_t d, int16_t w, void *arg);
+
+struct ili9341_circle {
+  int16_t x0;
+  int16_t y0;
+  uint8_t corners; // Quadrants to draw: 1=top left, 2=top right, 4=bottom right, 8=bottom left
+  int16_t w, h;    // Size of the rounded rectangle, for fills
+};
+
+// Walks the first quadrant of the circle, starting at offset 'from' (0 to
+// include the points on the axes, 1 to leave them out).
+static void ili9341_circle_runs(int16_t r, int16_t from, ili9341_circle_run_cb cb, void *arg) {
   int16_t f     = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
   int16_t x     = 0;
   int16_t y     = r;
+  int16_t hs    = from;
+  int16_t vs    = from;
 
   while (x < y) {
     if (f >= 0) {
+      if (hs <= x) {
+        cb(false, y, hs, x, arg);
+      }
+      if (vs <= x) {
+        cb(true, y, vs, x, arg);
+      }
+      hs = vs = x + 1;
       y--;
       ddF_y += 2;
       f     += ddF_y;
@@ -47,42 +79,28 @@ static void ili9341_drawCircleHelper(uint16_t x0, uint16_t y0, uint16_t r, uint8
     x++;
     ddF_x += 2;
     f     += ddF_x;
-    if (cornername & 0x1) {
-      mgos_ili9341_drawPixel(x0 - y, y0 - x);
-      mgos_ili9341_drawPixel(x0 - x, y0 - y);
-    }
-    if (cornername & 0x2) {
-      mgos_ili9341_drawPixel(x0 + x, y0 - y);
-      mgos_ili9341_drawPixel(x0 + y, y0 - x);
-    }
-    if (cornername & 0x4) {
-      mgos_ili9341_drawPixel(x0 + x, y0 + y);
-      mgos_ili9341_drawPixel(x0 + y, y0 + x);
-    }
-    if (cornername & 0x8) {
-      mgos_ili9341_drawPixel(x0 - y, y0 + x);
-      mgos_ili9341_drawPixel(x0 - x, y0 + y);
-    }
+  }
+  if (hs <= x) {
+    cb(false, y, hs, x, arg);
+  }
+  if (vs <= x) {
+    cb(true, y, vs, x, arg);
   }
 }
 
-static void ili9341_fillCircleHelper(uint16_t x0, uint16_t y0, uint16_t r, uint8_t cornername, int16_t delta) {
+static void ili9341_circle_rows(int16_t r, ili9341_circle_row_cb cb, void *arg) {
   int16_t f     = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
   int16_t x     = 0;
   int16_t y     = r;
-  int16_t ylm   = x0 - r;
 
+  cb(0, r, arg);
   while (x < y) {
     if (f >= 0) {
-      if (cornername & 0x1) {
-        mgos_ili9341_drawLine(x0 + y > 0 ? x0 + y : 0, y0 - x > 0 ? y0 - x : 0, x0 + y > 0 ? x0 + y : 0, y0 - x + 2 * x + 1 + delta);
+      if (y > x) {
+        cb(y, x, arg);
       }
-      if (cornername & 0x2) {
-        mgos_ili9341_drawLine(x0 - y > 0 ? x0 - y : 0, y0 - x > 0 ? y0 - x : 0, x0 - y > 0 ? x0 - y : 0, y0 - x + 2 * x + 1 + delta);
-      }
-      ylm = x0 - y;
       y--;
       ddF_y += 2;
       f     += ddF_y;
@@ -90,52 +108,90 @@ static void ili9341_fillCircleHelper(uint16_t x0, uint16_t y0, uint16_t r, uint8
     x++;
     ddF_x += 2;
     f     += ddF_x;
-
-    if ((x0 - x) > ylm) {
-      if (cornername & 0x1) {
-        mgos_ili9341_drawLine(x0 + x > 0 ? x0 + x : 0, y0 - y > 0 ? y0 - y : 0, x0 + x > 0 ? x0 + x : 0, y0 - y + 2 * y + 1 + delta);
-      }
-      if (cornername & 0x2) {
-        mgos_ili9341_drawLine(x0 - x > 0 ? x0 - x : 0, y0 - y > 0 ? y0 - y : 0, x0 - x > 0 ? x0 - x : 0, y0 - y + 2 * y + 1 + delta);
-      }
+    if (x <= y) {
+      cb(x, y, arg);
     }
   }
 }
 
-void mgos_ili9341_drawCircle(uint16_t x, uint16_t y, uint16_t r) {
-  int f     = 1 - r;
-  int ddF_x = 1;
-  int ddF_y = -2 * r;
-  int x1    = 0;
-  int y1    = r;
-
-  mgos_ili9341_drawPixel(x, y + r);
-  mgos_ili9341_drawPixel(x, y - r);
-  mgos_ili9341_drawPixel(x + r, y);
-  mgos_ili9341_drawPixel(x - r, y);
-  while (x1 < y1) {
-    if (f >= 0) {
-      y1--;
-      ddF_y += 2;
-      f     += ddF_y;
+// Draws a run on row (or column) c at offsets [a, b], mirrored into the
+// requested quadrants. Runs starting on an axis only occur for full circles
+// and are drawn as one span across both halves.
+static void ili9341_circle_outline_cb(bool vertical, int16_t c, int16_t a, int16_t b, void *arg) {
+  const struct ili9341_circle *ci = arg;
+
+  if (a == 0) {
+    if (vertical) {
+      ili9341_fill_clipped(ci->x0 - c, ci->y0 - b, ci->x0 - c, ci->y0 + b);
+      ili9341_fill_clipped(ci->x0 + c, ci->y0 - b, ci->x0 + c, ci->y0 + b);
+    } else {
+      ili9341_fill_clipped(ci->x0 - b, ci->y0 - c, ci->x0 + b, ci->y0 - c);
+      ili9341_fill_clipped(ci->x0 - b, ci->y0 + c, ci->x0 + b, ci->y0 + c);
     }
-    x1++;
-    ddF_x += 2;
-    f     += ddF_x;
-    mgos_ili9341_drawPixel(x + x1, y + y1);
-    mgos_ili9341_drawPixel(x - x1, y + y1);
-    mgos_ili9341_drawPixel(x + x1, y - y1);
-    mgos_ili9341_drawPixel(x - x1, y - y1);
-    mgos_ili9341_drawPixel(x + y1, y + x1);
-    mgos_ili9341_drawPixel(x - y1, y + x1);
-    mgos_ili9341_drawPixel(x + y1, y - x1);
-    mgos_ili9341_drawPixel(x - y1, y - x1);
+    return;
+  }
+  for (int q = 0; q < 4; q++) {
+    int16_t sx = (q == 1 || q == 2) ? 1 : -1;
+    int16_t sy = (q >= 2) ? 1 : -1;
+
+    if (!(ci->corners & (1 << q))) {
+      continue;
+    }
+    if (vertical) {
+      ili9341_fill_clipped(ci->x0 + sx * c, ci->y0 + (sy > 0 ? a : -b), ci->x0 + sx * c, ci->y0 + (sy > 0 ? b : -a));
+    } else {
+      ili9341_fill_clipped(ci->x0 + (sx > 0 ? a : -b), ci->y0 + sy * c, ci->x0 + (sx > 0 ? b : -a), ci->y0 + sy * c);
+    }
+  }
+}
+
+static void ili9341_fillCircle_cb(int16_t d, int16_t w, void *arg) {
+  const struct ili9341_circle *ci = arg;
+
+  ili9341_fill_clipped(ci->x0 - w, ci->y0 - d, ci->x0 + w, ci->y0 - d);
+  if (d > 0) {
+    ili9341_fill_clipped(ci->x0 - w, ci->y0 + d, ci->x0 + w, ci->y0 + d);
   }
 }
 
+// Rows above and below the straight part of a rounded rectangle, whose
+// corner circles are centered at (x0, y0) and (x0 + w - 2r - 1, y0 + h - 2r - 1).
+static void ili9341_fillRoundRect_cb(int16_t d, int16_t w, void *arg) {
+  const struct ili9341_circle *ci = arg;
+  int16_t                      x1 = ci->x0 + ci->w + w;
+
+  if (d == 0) {
+    return;
+  }
+  ili9341_fill_clipped(ci->x0 - w, ci->y0 - d, x1, ci->y0 - d);
+  ili9341_fill_clipped(ci->x0 - w, ci->y0 + ci->h + d, x1, ci->y0 + ci->h + d);
+}
+
+static void ili9341_circle_extents_cb(int16_t d, int16_t w, void *arg) {
+  ((int16_t *)arg)[d] = w;
+}
+
+// Sets ext[d] to the half width of row d of a filled circle, for d in [0, r].
+void ili9341_circle_extents(uint16_t r, int16_t *ext) {
+  ili9341_circle_rows(r, ili9341_circle_extents_cb, ext);
+}
+
+static void ili9341_drawCircleHelper(uint16_t x0, uint16_t y0, uint16_t r, uint8_t cornername) {
+  struct ili9341_circle ci = { .x0 = x0, .y0 = y0, .corners = cornername };
+
+  ili9341_circle_runs(r, 1, ili9341_circle_outline_cb, &ci);
+}
+
+void mgos_ili9341_drawCircle(uint16_t x, uint16_t y, uint16_t r) {
+  struct ili9341_circle ci = { .x0 = x, .y0 = y, .corners = 0xF };
+
+  ili9341_circle_runs(r, 0, ili9341_circle_outline_cb, &ci);
+}
+
 void mgos_ili9341_fillCircle(uint16_t x0, uint16_t y0, uint16_t r) {
-  mgos_ili9341_drawLine(x0, y0 - r > 0 ? y0 - r : 0, x0, y0 + r + 1);
-  ili9341_fillCircleHelper(x0, y0, r, 3, 0);
+  struct ili9341_circle ci = { .x0 = x0, .y0 = y0 };
+
+  ili9341_circle_rows(r, ili9341_fillCircle_cb, &ci);
 }
 
 void mgos_ili9341_drawRect(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h) {
@@ -160,9 +216,197 @@ void mgos_ili9341_drawRoundRect(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h
 }
 
 void mgos_ili9341_fillRoundRect(uint16_t x0, uint16_t y0, uint16_t w, uint16_t h, uint16_t r) {
-  mgos_ili9341_fillRect(x0 + r, y0, w - 2 * r, h);
-  ili9341_fillCircleHelper(x0 + w - r - 1, y0 + r, r, 1, h - 2 * r - 1);
-  ili9341_fillCircleHelper(x0 + r, y0 + r, r, 2, h - 2 * r - 1);
+  struct ili9341_circle ci = { .x0 = x0 + r, .y0 = y0 + r, .w = w - 2 * r - 1, .h = h - 2 * r - 1 };
+
+  ili9341_fill_clipped(x0, y0 + r, x0 + w - 1, y0 + h - r - 1);
+  ili9341_circle_rows(r, ili9341_fillRoundRect_cb, &ci);
+}
+
+// Sine of 0..90 degrees, scaled by 1024.
+static const int16_t ili9341_sin_table[91] = {
+     0,   18,   36,   54,   71,   89,  107,  125,  143,  160,  178,  195,  213,
+   230,  248,  265,  282,  299,  316,  333,  350,  367,  384,  400,  416,  433,
+   449,  465,  481,  496,  512,  527,  543,  558,  573,  587,  602,  616,  630,
+   644,  658,  672,  685,  698,  711,  724,  737,  749,  761,  773,  784,  796,
+   807,  818,  828,  839,  849,  859,  868,  878,  887,  896,  904,  912,  920,
+   928,  935,  943,  949,  956,  962,  968,  974,  979,  984,  989,  994,  998,
+  1002, 1005, 1008, 1011, 1014, 1016, 1018, 1020, 1022, 1023, 1023, 1024, 1024,
+};
+
+static int32_t ili9341_sin(int16_t deg) {
+  deg %= 360;
+  if (deg < 0) {
+    deg += 360;
+  }
+  if (deg <= 90) {
+    return ili9341_sin_table[deg];
+  }
+  if (deg <= 180) {
+    return ili9341_sin_table[180 - deg];
+  }
+  if (deg <= 270) {
+    return -ili9341_sin_table[deg - 180];
+  }
+  return -ili9341_sin_table[360 - deg];
+}
+
+static int32_t ili9341_cos(int16_t deg) {
+  return ili9341_sin(deg + 90);
+}
+
+// Sectors are filled in pieces of at most this many tenths of a degree, so
+// that each piece is convex and crosses a row in a single span.
+#define ILI9341_SECTOR_PIECE    900
+
+static int32_t ili9341_floor_div(int32_t n, int32_t d) {
+  return n >= 0 ? n / d : -((-n + d - 1) / d);
+}
+
+static int32_t ili9341_ceil_div(int32_t n, int32_t d) {
+  return -ili9341_floor_div(-n, d);
+}
+
+// Whether angle x lies in [a, b], all in tenths of a degree.
+static bool ili9341_angle_in(int32_t x, int32_t a, int32_t b) {
+  return x - a - ili9341_floor_div(x - a, 3600) * 3600 <= b - a;
+}
+
+// Direction of angle a, in tenths of a degree, scaled by 1024 and
+// interpolated between whole degrees.
+static void ili9341_sector_vector(int32_t a, int32_t *x, int32_t *y) {
+  int16_t deg  = ili9341_floor_div(a, 10) % 360;
+  int32_t frac = a - ili9341_floor_div(a, 10) * 10;
+
+  *x = ili9341_cos(deg) + (ili9341_cos(deg + 1) - ili9341_cos(deg)) * frac / 10;
+  *y = ili9341_sin(deg) + (ili9341_sin(deg + 1) - ili9341_sin(deg)) * frac / 10;
+}
+
+// Fills the part of [a, b] on row dy that lies in the convex sector with
+// start vector s and end vector e, leaving out the end ray.
+static void ili9341_sector_span(const struct ili9341_ring *ring, int16_t dy, int32_t a, int32_t b,
+                                int32_t sx, int32_t sy, int32_t ex, int32_t ey) {
+  // sx * dy - sy * dx >= 0
+  if (sy > 0) {
+    int32_t m = ili9341_floor_div(sx * dy, sy);
+    b = m < b ? m : b;
+  } else if (sy < 0) {
+    int32_t m = ili9341_ceil_div(-sx * dy, -sy);
+    a = m > a ? m : a;
+  } else if (sx * dy < 0) {
+    return;
+  }
+  // dx * ey - dy * ex > 0
+  if (ey > 0) {
+    int32_t m = ili9341_floor_div(ex * dy, ey) + 1;
+    a = m > a ? m : a;
+  } else if (ey < 0) {
+    int32_t m = ili9341_ceil_div(-ex * dy, -ey) - 1;
+    b = m < b ? m : b;
+  } else if (dy * ex >= 0) {
+    return;
+  }
+  if (a <= b) {
+    ili9341_fill_clipped(ring->x0 + a, ring->y0 + dy, ring->x0 + b, ring->y0 + dy);
+  }
+}
+
+// Rows of the ring that the piece from angle p to q can cover: those between
+// the ends of its rays, and up to the top or bottom of the ring if it
+// contains 270 or 90 degrees.
+static void ili9341_sector_rows(const struct ili9341_ring *ring, int32_t p, int32_t q,
+                                int32_t sy, int32_t ey, int16_t *dy0, int16_t *dy1) {
+  int32_t ro = ring->r_outer, ri = ring->r_inner;
+  int32_t lo = sy * ro, hi = sy * ro;
+
+  lo = ey * ro < lo ? ey * ro : lo;
+  hi = ey * ro > hi ? ey * ro : hi;
+  lo = sy * ri < lo ? sy * ri : lo;
+  hi = sy * ri > hi ? sy * ri : hi;
+  lo = ey * ri < lo ? ey * ri : lo;
+  hi = ey * ri > hi ? ey * ri : hi;
+  *dy0 = ili9341_angle_in(2700, p, q) ? -ro : ili9341_floor_div(lo, 1024) - 1;
+  *dy1 = ili9341_angle_in(900, p, q) ? ro : ili9341_ceil_div(hi, 1024) + 1;
+  *dy0 = *dy0 < -ro ? -ro : *dy0;
+  *dy1 = *dy1 > ro ? ro : *dy1;
+}
+
+// Fills the sector [a, b) of the ring, angles in tenths of a degree. Pixels
+// belong to a sector by their angle, so that neighbouring sectors never
+// overlap or leave gaps. The center pixel of a ring without a hole has no
+// angle; it belongs to the sector that contains the ring's center angle.
+void ili9341_ring_sector(const struct ili9341_ring *ring, int32_t a, int32_t b) {
+  if (a >= b) {
+    return;
+  }
+  for (int16_t dy = -ring->r_outer; b - a >= 3600 && dy <= ring->r_outer; dy++) {
+    int16_t d  = dy < 0 ? -dy : dy;
+    int16_t wo = ring->ext_o[d];
+
+    if (ring->ext_i && d <= ring->r_inner) {
+      ili9341_fill_clipped(ring->x0 - wo, ring->y0 + dy, ring->x0 - ring->ext_i[d] - 1, ring->y0 + dy);
+      ili9341_fill_clipped(ring->x0 + ring->ext_i[d] + 1, ring->y0 + dy, ring->x0 + wo, ring->y0 + dy);
+    } else {
+      ili9341_fill_clipped(ring->x0 - wo, ring->y0 + dy, ring->x0 + wo, ring->y0 + dy);
+    }
+  }
+  if (b - a >= 3600) {
+    return;
+  }
+  for (int32_t p = a; p < b; p += ILI9341_SECTOR_PIECE) {
+    int32_t q = p + ILI9341_SECTOR_PIECE < b ? p + ILI9341_SECTOR_PIECE : b;
+    int32_t sx, sy, ex, ey;
+    int16_t dy0, dy1;
+
+    ili9341_sector_vector(p, &sx, &sy);
+    ili9341_sector_vector(q, &ex, &ey);
+    ili9341_sector_rows(ring, p, q, sy, ey, &dy0, &dy1);
+    for (int16_t dy = dy0; dy <= dy1; dy++) {
+      int16_t d  = dy < 0 ? -dy : dy;
+      int16_t wo = ring->ext_o[d];
+      int16_t wi = (ring->ext_i && d <= ring->r_inner) ? ring->ext_i[d] : -1;
+
+      if (wi < 0) {
+        ili9341_sector_span(ring, dy, -wo, wo, sx, sy, ex, ey);
+      } else {
+        ili9341_sector_span(ring, dy, -wo, -wi - 1, sx, sy, ex, ey);
+        ili9341_sector_span(ring, dy, wi + 1, wo, sx, sy, ex, ey);
+      }
+    }
+  }
+  if (!ring->ext_i && ili9341_angle_in(ring->center, a, b - 1)) {
+    ili9341_fill_clipped(ring->x0, ring->y0, ring->x0, ring->y0);
+  }
+}
+
+#define ILI9341_ARC_MAX_RADIUS    160
+void mgos_ili9341_fillArc(uint16_t x0, uint16_t y0, uint16_t r_outer, uint16_t r_inner, int16_t start, int16_t end) {
+  int16_t             ext_o[ILI9341_ARC_MAX_RADIUS + 1];
+  int16_t             ext_i[ILI9341_ARC_MAX_RADIUS + 1];
+  int32_t             sweep = end - start;
+  struct ili9341_ring ring  = {
+    .x0      = x0,
+    .y0      = y0,
+    .r_outer = r_outer,
+    .r_inner = r_inner,
+    .ext_o   = ext_o,
+    .ext_i   = r_inner > 0 ? ext_i : NULL,
+    .center  = start * 10,
+  };
+
+  if (r_outer > ILI9341_ARC_MAX_RADIUS || r_inner >= r_outer || sweep == 0) {
+    return;
+  }
+  if (sweep < 0) {
+    sweep = sweep % 360 + 360;
+  }
+  if (sweep > 360) {
+    sweep = 360;
+  }
+  ili9341_circle_extents(r_outer, ext_o);
+  if (r_inner > 0) {
+    ili9341_circle_extents(r_inner, ext_i);
+  }
+  ili9341_ring_sector(&ring, start * 10, (start + sweep) * 10);
 }
 
 void mgos_ili9341_drawTriangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
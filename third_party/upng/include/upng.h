@@ -57,12 +57,19 @@ typedef enum upng_format {
 
 typedef struct upng_t upng_t;
 
+/* reads up to len bytes into buf; returns the number read, or 0 or less at the end of the input */
+typedef int (*upng_read_cb)(void *arg, unsigned char *buf, unsigned len);
+/* receives unfiltered scanline y; returns 0 to stop decoding */
+typedef int (*upng_row_cb)(void *arg, unsigned y, const unsigned char *row);
+
 upng_t *upng_new_from_bytes(const unsigned char *buffer, unsigned long size);
 upng_t *upng_new_from_file(const char *path);
+upng_t *upng_new_from_stream(upng_read_cb read, void *arg);
 void            upng_free(upng_t *upng);
 
 upng_error      upng_header(upng_t *upng);
 upng_error      upng_decode(upng_t *upng);
+upng_error      upng_decode_rows(upng_t *upng, upng_row_cb row, void *arg);
 
 upng_error      upng_get_error(const upng_t *upng);
 unsigned        upng_get_error_line(const upng_t *upng);
@@ -1,5 +1,6 @@
 /*
  * uPNG -- derived from LodePNG version 20100808
+ * Altered: streamed decoding added, see README.md
  *
  * Copyright (c) 2005-2010 Lode Vandevenne
  * Copyright (c) 2010 Sean Middleditch
@@ -76,10 +77,15 @@ typedef enum upng_color {
   UPNG_RGBA = 6
 } upng_color;
 
+#define UPNG_HEADER_SIZE            33  /* signature and IHDR chunk */
+
 typedef struct upng_source {
   const unsigned char *buffer;
   unsigned long        size;
   char                 owning;
+  upng_read_cb         read;                      /* streamed sources only */
+  void *               read_arg;
+  unsigned char        header[UPNG_HEADER_SIZE];
 } upng_source;
 
 struct upng_t {
@@ -203,7 +209,7 @@ static void huffman_tree_init(huffman_tree *tree, unsigned *buffer, unsigned num
 /*given the code lengths (as stored in the PNG file), generate the tree as defined by Deflate. maxbitlen is the maximum bits that a code in the tree can have. return value is error.*/
 static void huffman_tree_create_lengths(upng_t *upng, huffman_tree *tree, const unsigned *bitlen) {
   unsigned tree1d[MAX_SYMBOLS];
-  unsigned blcount[MAX_BIT_LENGTH];
+  unsigned blcount[MAX_BIT_LENGTH + 1];   /* code lengths run from 0 to MAX_BIT_LENGTH */
   unsigned nextcode[MAX_BIT_LENGTH + 1];
   unsigned bits, n, i;
   unsigned nodefilled = 0;      /*up to which node it is filled */
@@ -535,7 +541,7 @@ static void inflate_huffman(upng_t *upng, unsigned char *out, unsigned long outs
       start    = (*pos);
       backward = start - distance;
 
-      if ((*pos) + length >= outsize) {
+      if ((*pos) + length > outsize) {
         SET_ERROR(upng, UPNG_EMALFORMED);
         return;
       }
@@ -579,7 +585,7 @@ static void inflate_uncompressed(upng_t *upng, unsigned char *out, unsigned long
     return;
   }
 
-  if ((*pos) + len >= outsize) {
+  if ((*pos) + len > outsize) {
     SET_ERROR(upng, UPNG_EMALFORMED);
     return;
   }
@@ -615,7 +621,7 @@ static upng_error uz_inflate_data(upng_t *upng, unsigned char *out, unsigned lon
 
     /* read block control bits */
     done  = read_bit(&bp, &in[inpos]);
-    btype = read_bit(&bp, &in[inpos]) | (read_bit(&bp, &in[inpos]) << 1);
+    btype = read_bits(&bp, &in[inpos], 2);
 
     /* process control type appropriateyly */
     if (btype == 3) {
@@ -932,6 +938,22 @@ upng_error upng_header(upng_t *upng) {
     return upng->error;
   }
 
+  /* streamed sources only hold the signature and IHDR chunk, the rest is read by upng_decode_rows */
+  if (upng->source.read != NULL && upng->source.buffer == NULL) {
+    unsigned long n;
+    int           ret;
+
+    for (n = 0; n < UPNG_HEADER_SIZE; n += ret) {
+      ret = upng->source.read(upng->source.read_arg, upng->source.header + n, UPNG_HEADER_SIZE - n);
+      if (ret <= 0) {
+        SET_ERROR(upng, UPNG_ENOTPNG);
+        return upng->error;
+      }
+    }
+    upng->source.buffer = upng->source.header;
+    upng->source.size   = UPNG_HEADER_SIZE;
+  }
+
   /* minimum length of a valid PNG file is 29 bytes
    * FIXME: verify this against the specification, or
    * better against the actual code below */
@@ -1012,6 +1034,12 @@ upng_error upng_decode(upng_t *upng) {
     return upng->error;
   }
 
+  /* streamed sources can only be decoded by upng_decode_rows */
+  if (upng->source.read != NULL) {
+    SET_ERROR(upng, UPNG_EPARAM);
+    return upng->error;
+  }
+
   /* release old result, if any */
   if (upng->buffer != 0) {
     free(upng->buffer);
@@ -1139,6 +1167,388 @@ upng_error upng_decode(upng_t *upng) {
   return upng->error;
 }
 
+/*
+ * Streamed decoding: the IDAT chunks are read through the source read callback and inflated into a
+ * ring buffer the size of the zlib window, and every scanline is unfiltered and handed to a callback
+ * as soon as it is complete. Only the window, two scanlines and the state below are kept in memory.
+ */
+#define UPNG_STREAM_IN_SIZE    512
+
+typedef struct upng_stream {
+  upng_t *       upng;
+  upng_row_cb    row;
+  void *         row_arg;
+  int            stop;                                 /* the last scanline was delivered, or row returned 0 */
+
+  unsigned char  in[UPNG_STREAM_IN_SIZE];              /* IDAT payload */
+  unsigned       in_len;
+  unsigned       in_pos;
+  unsigned long  chunk_left;                           /* bytes of the current IDAT chunk not read yet */
+  unsigned long  skip;                                 /* bytes to skip before the next chunk header */
+  unsigned long  bits;                                 /* bit buffer, lsb first */
+  unsigned       nbits;
+
+  unsigned       codetree_buffer[DEFLATE_CODE_BUFFER_SIZE];
+  unsigned       codetreeD_buffer[DISTANCE_BUFFER_SIZE];
+  unsigned       codelengthcodetree_buffer[CODE_LENGTH_BUFFER_SIZE];
+  unsigned       bitlen[NUM_DEFLATE_CODE_SYMBOLS + NUM_DISTANCE_SYMBOLS];
+
+  unsigned char *window;
+  unsigned long  window_mask;                          /* window size - 1 */
+  unsigned long  window_pos;                           /* total bytes inflated */
+
+  unsigned char *line[2];                              /* current and previous scanline, each with its filter type byte */
+  unsigned long  linebytes;
+  unsigned long  line_pos;
+  unsigned long  bytewidth;
+  unsigned       y;
+} upng_stream;
+
+/* reads exactly len bytes from the source, or skips them through the input buffer if buf is NULL */
+static void stream_read(upng_stream *s, unsigned char *buf, unsigned long len) {
+  upng_t *upng = s->upng;
+
+  while (len > 0 && upng->error == UPNG_EOK) {
+    unsigned char *dst = buf ? buf : s->in;
+    unsigned       n   = len;
+    int            ret;
+
+    if (buf == NULL && n > UPNG_STREAM_IN_SIZE) {
+      n = UPNG_STREAM_IN_SIZE;
+    }
+    ret = upng->source.read(upng->source.read_arg, dst, n);
+    if (ret <= 0) {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+      return;
+    }
+    len -= ret;
+    if (buf) {
+      buf += ret;
+    }
+  }
+}
+
+/* refills the input buffer from the next IDAT chunks, skipping CRCs and ancillary chunks in between */
+static void stream_refill(upng_stream *s) {
+  upng_t *upng = s->upng;
+
+  while (s->chunk_left == 0 && upng->error == UPNG_EOK) {
+    unsigned char chunk[8];
+
+    stream_read(s, NULL, s->skip);
+    stream_read(s, chunk, sizeof(chunk));
+    if (upng->error != UPNG_EOK) {
+      return;
+    }
+    if (upng_chunk_length(chunk) > INT_MAX) {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+    } else if (upng_chunk_type(chunk) == CHUNK_IDAT) {
+      s->chunk_left = upng_chunk_length(chunk);
+      s->skip       = 4;
+    } else if (upng_chunk_type(chunk) == CHUNK_IEND) {
+      SET_ERROR(upng, UPNG_EMALFORMED);                 /* the image data ended early */
+    } else if (upng_chunk_critical(chunk)) {
+      SET_ERROR(upng, UPNG_EUNSUPPORTED);
+    } else {
+      s->skip = upng_chunk_length(chunk) + 4;
+    }
+  }
+  if (upng->error != UPNG_EOK) {
+    return;
+  }
+
+  s->in_len = s->chunk_left < UPNG_STREAM_IN_SIZE ? s->chunk_left : UPNG_STREAM_IN_SIZE;
+  s->in_pos = 0;
+  stream_read(s, s->in, s->in_len);
+  s->chunk_left -= s->in_len;
+}
+
+static unsigned stream_bits(upng_stream *s, unsigned nbits) {
+  unsigned result;
+
+  while (s->nbits < nbits) {
+    if (s->in_pos == s->in_len) {
+      stream_refill(s);
+      if (s->upng->error != UPNG_EOK) {
+        return 0;
+      }
+    }
+    s->bits  |= (unsigned long)s->in[s->in_pos++] << s->nbits;
+    s->nbits += 8;
+  }
+  result    = s->bits & ((1UL << nbits) - 1);
+  s->bits >>= nbits;
+  s->nbits -= nbits;
+  return result;
+}
+
+static unsigned stream_decode_symbol(upng_stream *s, const huffman_tree *codetree) {
+  unsigned treepos = 0, ct;
+
+  for (;;) {
+    unsigned bit = stream_bits(s, 1);
+    if (s->upng->error != UPNG_EOK) {
+      return 0;
+    }
+
+    ct = codetree->tree2d[(treepos << 1) | bit];
+    if (ct < codetree->numcodes) {
+      return ct;
+    }
+
+    treepos = ct - codetree->numcodes;
+    if (treepos >= codetree->numcodes) {
+      SET_ERROR(s->upng, UPNG_EMALFORMED);
+      return 0;
+    }
+  }
+}
+
+/* stores an inflated byte; completed scanlines are unfiltered and delivered */
+static void stream_output(upng_stream *s, unsigned char byte) {
+  unsigned char *line = s->line[s->y & 1];
+
+  s->window[s->window_pos++ & s->window_mask] = byte;
+  if (s->stop) {
+    return;
+  }
+  line[s->line_pos++] = byte;
+  if (s->line_pos < s->linebytes + 1) {
+    return;
+  }
+
+  unfilter_scanline(s->upng, line + 1, line + 1, s->y > 0 ? s->line[(s->y - 1) & 1] + 1 : NULL, s->bytewidth, line[0], s->linebytes);
+  if (s->upng->error != UPNG_EOK) {
+    return;
+  }
+  if (!s->row(s->row_arg, s->y, line + 1) || s->y + 1 == s->upng->height) {
+    s->stop = 1;
+  }
+  s->line_pos = 0;
+  s->y++;
+}
+
+/* same as get_tree_inflate_dynamic, reading from the stream */
+static void stream_get_tree_dynamic(upng_stream *s, huffman_tree *codetree, huffman_tree *codetreeD, huffman_tree *codelengthcodetree) {
+  upng_t * upng = s->upng;
+  unsigned codelengthcode[NUM_CODE_LENGTH_CODES];
+  unsigned hlit, hdist, hclen, i, n;
+
+  memset(s->bitlen, 0, sizeof(s->bitlen));
+
+  hlit  = stream_bits(s, 5) + 257;
+  hdist = stream_bits(s, 5) + 1;
+  hclen = stream_bits(s, 4) + 4;
+
+  for (i = 0; i < NUM_CODE_LENGTH_CODES; i++) {
+    codelengthcode[CLCL[i]] = i < hclen ? stream_bits(s, 3) : 0;
+  }
+  if (upng->error != UPNG_EOK || hlit > NUM_DEFLATE_CODE_SYMBOLS || hdist > NUM_DISTANCE_SYMBOLS) {
+    if (upng->error == UPNG_EOK) {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+    }
+    return;
+  }
+
+  huffman_tree_create_lengths(upng, codelengthcodetree, codelengthcode);
+
+  /* the lit/len code lengths are followed by the distance code lengths, repeats may cross between the two */
+  i = 0;
+  while (i < hlit + hdist && upng->error == UPNG_EOK) {
+    unsigned code = stream_decode_symbol(s, codelengthcodetree);
+    unsigned replength, value = 0;
+
+    if (code <= 15) {
+      replength = 1;
+      value     = code;
+    } else if (code == 16) {
+      if (i == 0) {
+        SET_ERROR(upng, UPNG_EMALFORMED);
+        break;
+      }
+      replength = 3 + stream_bits(s, 2);
+      value     = s->bitlen[i - 1 < hlit ? i - 1 : NUM_DEFLATE_CODE_SYMBOLS + i - 1 - hlit];
+    } else if (code == 17) {
+      replength = 3 + stream_bits(s, 3);
+    } else if (code == 18) {
+      replength = 11 + stream_bits(s, 7);
+    } else {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+      break;
+    }
+
+    for (n = 0; n < replength && upng->error == UPNG_EOK; n++, i++) {
+      if (i >= hlit + hdist) {
+        SET_ERROR(upng, UPNG_EMALFORMED);
+      } else if (i < hlit) {
+        s->bitlen[i] = value;
+      } else {
+        s->bitlen[NUM_DEFLATE_CODE_SYMBOLS + i - hlit] = value;
+      }
+    }
+  }
+
+  if (upng->error == UPNG_EOK && s->bitlen[256] == 0) {
+    SET_ERROR(upng, UPNG_EMALFORMED);
+  }
+  if (upng->error == UPNG_EOK) {
+    huffman_tree_create_lengths(upng, codetree, s->bitlen);
+  }
+  if (upng->error == UPNG_EOK) {
+    huffman_tree_create_lengths(upng, codetreeD, s->bitlen + NUM_DEFLATE_CODE_SYMBOLS);
+  }
+}
+
+static void stream_inflate_huffman(upng_stream *s, unsigned btype) {
+  upng_t *     upng = s->upng;
+  huffman_tree codetree;
+  huffman_tree codetreeD;
+
+  if (btype == 1) {
+    huffman_tree_init(&codetree, (unsigned *)FIXED_DEFLATE_CODE_TREE, NUM_DEFLATE_CODE_SYMBOLS, DEFLATE_CODE_BITLEN);
+    huffman_tree_init(&codetreeD, (unsigned *)FIXED_DISTANCE_TREE, NUM_DISTANCE_SYMBOLS, DISTANCE_BITLEN);
+  } else {
+    huffman_tree codelengthcodetree;
+
+    huffman_tree_init(&codetree, s->codetree_buffer, NUM_DEFLATE_CODE_SYMBOLS, DEFLATE_CODE_BITLEN);
+    huffman_tree_init(&codetreeD, s->codetreeD_buffer, NUM_DISTANCE_SYMBOLS, DISTANCE_BITLEN);
+    huffman_tree_init(&codelengthcodetree, s->codelengthcodetree_buffer, NUM_CODE_LENGTH_CODES, CODE_LENGTH_BITLEN);
+    stream_get_tree_dynamic(s, &codetree, &codetreeD, &codelengthcodetree);
+  }
+
+  while (upng->error == UPNG_EOK && !s->stop) {
+    unsigned code = stream_decode_symbol(s, &codetree);
+
+    if (upng->error != UPNG_EOK || code == 256) {
+      return;
+    } else if (code <= 255) {
+      stream_output(s, (unsigned char)code);
+    } else if (code <= LAST_LENGTH_CODE_INDEX) {
+      unsigned long length = LENGTH_BASE[code - FIRST_LENGTH_CODE_INDEX];
+      unsigned long distance;
+      unsigned      codeD;
+
+      length += stream_bits(s, LENGTH_EXTRA[code - FIRST_LENGTH_CODE_INDEX]);
+      codeD   = stream_decode_symbol(s, &codetreeD);
+      if (upng->error != UPNG_EOK) {
+        return;
+      }
+      if (codeD > 29) {
+        SET_ERROR(upng, UPNG_EMALFORMED);
+        return;
+      }
+      distance = DISTANCE_BASE[codeD] + stream_bits(s, DISTANCE_EXTRA[codeD]);
+
+      /* the distance may not reach back past the start of the data or the window */
+      if (distance > s->window_pos || distance > s->window_mask + 1) {
+        SET_ERROR(upng, UPNG_EMALFORMED);
+        return;
+      }
+      while (length-- > 0 && !s->stop) {
+        stream_output(s, s->window[(s->window_pos - distance) & s->window_mask]);
+      }
+    } else {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+    }
+  }
+}
+
+static void stream_inflate_uncompressed(upng_stream *s) {
+  unsigned len, nlen;
+
+  /* go to first boundary of byte */
+  stream_bits(s, s->nbits & 7);
+
+  len  = stream_bits(s, 16);
+  nlen = stream_bits(s, 16);
+  if (s->upng->error == UPNG_EOK && len + nlen != 65535) {
+    SET_ERROR(s->upng, UPNG_EMALFORMED);
+  }
+  while (len-- > 0 && s->upng->error == UPNG_EOK && !s->stop) {
+    stream_output(s, (unsigned char)stream_bits(s, 8));
+  }
+}
+
+/*decode a streamed PNG scanline by scanline, handing each to row, which may stop decoding early*/
+upng_error upng_decode_rows(upng_t *upng, upng_row_cb row, void *arg) {
+  upng_stream *s;
+  unsigned     cmf, flg, done = 0;
+
+  if (upng->source.read == NULL) {
+    SET_ERROR(upng, UPNG_EPARAM);
+    return upng->error;
+  }
+
+  upng_header(upng);
+  if (upng->error != UPNG_EOK) {
+    return upng->error;
+  }
+  if (upng->state != UPNG_HEADER) {
+    SET_ERROR(upng, UPNG_EPARAM);                       /* the stream was decoded already */
+    return upng->error;
+  }
+  if (upng->width == 0 || upng->height == 0) {
+    SET_ERROR(upng, UPNG_EMALFORMED);
+    return upng->error;
+  }
+
+  s = (upng_stream *)calloc(1, sizeof(upng_stream));
+  if (s == NULL) {
+    SET_ERROR(upng, UPNG_ENOMEM);
+    return upng->error;
+  }
+  s->upng      = upng;
+  s->row       = row;
+  s->row_arg   = arg;
+  s->linebytes = (upng->width * upng_get_bpp(upng) + 7) / 8;
+  s->bytewidth = (upng_get_bpp(upng) + 7) / 8;
+
+  /* zlib header, see uz_inflate; the window is only as large as the encoder says it needs */
+  cmf = stream_bits(s, 8);
+  flg = stream_bits(s, 8);
+  if (upng->error == UPNG_EOK && ((cmf * 256 + flg) % 31 != 0 || (cmf & 15) != 8 || (cmf >> 4) > 7 || ((flg >> 5) & 1) != 0)) {
+    SET_ERROR(upng, UPNG_EMALFORMED);
+  }
+  if (upng->error == UPNG_EOK) {
+    s->window_mask = (1UL << ((cmf >> 4) + 8)) - 1;
+    s->window      = (unsigned char *)malloc(s->window_mask + 1);
+    s->line[0]     = (unsigned char *)malloc(s->linebytes + 1);
+    s->line[1]     = (unsigned char *)malloc(s->linebytes + 1);
+    if (s->window == NULL || s->line[0] == NULL || s->line[1] == NULL) {
+      SET_ERROR(upng, UPNG_ENOMEM);
+    }
+  }
+
+  while (upng->error == UPNG_EOK && !s->stop && !done) {
+    unsigned btype;
+
+    done  = stream_bits(s, 1);
+    btype = stream_bits(s, 2);
+    if (upng->error != UPNG_EOK) {
+      break;
+    }
+    if (btype == 3) {
+      SET_ERROR(upng, UPNG_EMALFORMED);
+    } else if (btype == 0) {
+      stream_inflate_uncompressed(s);
+    } else {
+      stream_inflate_huffman(s, btype);
+    }
+  }
+  if (upng->error == UPNG_EOK && !s->stop) {
+    SET_ERROR(upng, UPNG_EMALFORMED);                   /* the data ended before the last scanline */
+  }
+  if (upng->error == UPNG_EOK) {
+    upng->state = UPNG_DECODED;
+  }
+
+  free(s->window);
+  free(s->line[0]);
+  free(s->line[1]);
+  free(s);
+  return upng->error;
+}
+
 static upng_t *upng_new(void) {
   upng_t *upng;
 
@@ -1161,9 +1571,11 @@ static upng_t *upng_new(void) {
   upng->error      = UPNG_EOK;
   upng->error_line = 0;
 
-  upng->source.buffer = NULL;
-  upng->source.size   = 0;
-  upng->source.owning = 0;
+  upng->source.buffer   = NULL;
+  upng->source.size     = 0;
+  upng->source.owning   = 0;
+  upng->source.read     = NULL;
+  upng->source.read_arg = NULL;
 
   return upng;
 }
@@ -1222,6 +1634,19 @@ upng_t *upng_new_from_file(const char *filename) {
   return upng;
 }
 
+upng_t *upng_new_from_stream(upng_read_cb read, void *arg) {
+  upng_t *upng = upng_new();
+
+  if (upng == NULL) {
+    return NULL;
+  }
+
+  upng->source.read     = read;
+  upng->source.read_arg = arg;
+
+  return upng;
+}
+
 void upng_free(upng_t *upng) {
   /* deallocate image buffer */
   if (upng->buffer != NULL) {